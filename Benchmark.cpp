@@ -0,0 +1,2330 @@
+// Headless benchmarks for the Unicore menu and the Dear ImGui demo window.
+// Drives frames through imgui_impl_null (no window, no GPU) so UI-core cost can be measured on any box.
+// Suites:
+//   frames     CPU time of full frames (NewFrame + UI + Render), vertex/index/draw command counts, vertex bytes uploaded per frame with the
+//              vertex layout of this build (build with and without IMGUI_USE_COMPACT_DRAWVERT to compare). The '-mrg' scenarios enable io.ConfigRenderMergeDrawLists.
+//              The '-gi' scenarios output text as glyph instances (io.ConfigRenderGlyphInstances): upload bytes and draw calls vs vertices.
+//              Heap allocations made by the measured frames (after warm-up, expected to be 0) and frame arena bytes used per frame.
+//   soft       imgui_impl_soft rasterization time at 1080p and 4K, for 1 to N threads. Check that text output as glyph instances has the same pixels
+//              as text output as vertices.
+//   replay     record frames with imgui_capture, then replay them through the null and soft renderers without running any UI code
+//   input      record a scripted interaction session with the menu (hover, tab switches, drags, typing) into an input file, or replay it
+//              when the file already exists. The session checksum only matches between runs if every frame is bit-identical (and built with the same ID hash).
+//              The session is then replayed a second time in the same context: the suite fails if any of those steady-state frames allocates.
+//              Build with -DIMGUI_ENABLE_ALLOC_TRACKING to list the subsystems and windows which allocated.
+//   idle       run a scripted session of the menu through ImGuiFrameScheduler with a mock clock: frames rendered vs a 60 Hz loop, and check
+//              that the last frame matches the one of the 60 Hz loop.
+//   atlas      font atlas build time (menu font at several sizes, plus --font merged with the full Chinese ranges) for 1 to N threads
+//              through ImFontAtlas::BuildParallelForFn, and check that the texture and glyphs match the single-threaded build.
+//              Startup time and texture size with a large range baked or rasterized on demand (ImFontConfig::GlyphsOnDemand), and a session
+//              with a small page budget checking that on-demand glyphs match their baked version.
+//              Build time and texture size of one signed distance field font (ImFontConfig::SignedDistanceField) vs the same font baked
+//              at 5 sizes, and the error of SDF text rendered by imgui_impl_soft at those sizes (and of the 16 px font scaled) vs the baked text:
+//              fails when the mean or max SDF error exceeds g_AtlasSdfMaxMeanError or g_AtlasSdfMaxError.
+//              Adding a font and custom rects to a built atlas: full rebuild + texture upload vs ImFontAtlas::BuildAppend() + upload of the dirty rects.
+//              Startup time of the menu font without cache, with a cold cache (build + save) and a warm cache (imgui_atlas_cache).
+//   micro      ns per operation of the core hot paths (hashing, storage, text, draw list, atlas build, .ini loading) and of full frames.
+//              The 'menu_labels' and 'checkbox_labels' cases compare widget IDs of string literal labels hashed at run time vs with IM_LABEL().
+//              --json writes the results, --baseline compares them with a previous --json output and fails on regressions beyond --threshold percent.
+//              Build with -DIMGUI_DISABLE_SSE to measure the scalar tessellation paths of imgui_draw.cpp, or with -mavx2 to measure its AVX2 normals.
+//   hash       ID hash speed and collisions vs a random 32-bit hash, on the string literals of the menu and the demo window (alone and
+//              nested in each other), generated "Object %d##%d" labels and PushID() keys. Build with -DIMGUI_USE_HASH_WYHASH or
+//              -DIMGUI_USE_HASH_CRC32C -msse4.2 to compare with the default CRC32.
+//   storage    sorted vs hashed ImGuiStorage (ImGuiStorage::SetHashed()) from 10 to 1M pairs: insertion, bulk build, hit and miss queries, memory.
+//
+// Build (Linux):
+//   g++ -O2 -std=c++17 -pthread -I. -IImGui Benchmark.cpp MenuUI.cpp ImGui/imgui.cpp ImGui/imgui_draw.cpp ImGui/imgui_widgets.cpp ImGui/imgui_demo.cpp ImGui/imgui_impl_null.cpp ImGui/imgui_impl_soft.cpp ImGui/imgui_capture.cpp ImGui/imgui_input_capture.cpp ImGui/imgui_frame_scheduler.cpp ImGui/imgui_atlas_cache.cpp -o Benchmark
+// Run from the repository root so the menu font can be found:
+//   ./Benchmark [suite] [--frames N] [--size WxH] [--threads N] [--dump file.ppm] [--capture file.imdc] [--inputs file.imir]
+//              [--font file.ttf] [--json out.json] [--baseline base.json] [--threshold percent] [--filter name] [--sample-ms ms]
+
+#include "ImGui/imgui.h"
+#include "ImGui/imgui_impl_null.h"
+#include "ImGui/imgui_impl_soft.h"
+#include "ImGui/imgui_capture.h"
+#include "ImGui/imgui_input_capture.h"
+#include "ImGui/imgui_frame_scheduler.h"
+#include "ImGui/imgui_atlas_cache.h"
+#include "ImGui/imgui_internal.h"     // ImHashStr, ImHashData, FindWindowByName, ImGuiTabBar
+#include "MenuUI.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <thread>
+
+struct BenchmarkOptions
+{
+    const char* Suite = NULL;       // NULL: run every suite
+    int         Frames = 1000;
+    int         Width = 0;          // 0: suite default
+    int         Height = 0;
+    int         MaxThreads = 0;     // 0: one per hardware thread
+    const char* DumpFilename = NULL;
+    const char* CaptureFilename = NULL; // NULL: record into a temporary file
+    const char* InputsFilename = NULL;  // NULL: Benchmark_inputs.imir
+    const char* FontFilename = NULL;    // Extra font for the atlas suite, e.g. a CJK font
+    const char* JsonFilename = NULL;
+    const char* BaselineFilename = NULL;
+    const char* Filter = NULL;          // Only run micro benchmarks whose name contains this string
+    double      Threshold = 10.0;       // Regression threshold, in percent
+    double      MicroSampleMs = 20.0;
+};
+
+struct BenchmarkSummary
+{
+    double  AvgMs = 0.0, MinMs = 0.0, MaxMs = 0.0, P50Ms = 0.0, P99Ms = 0.0;
+    double  AvgRenderMs = 0.0;
+    double  AvgVtx = 0.0, AvgIdx = 0.0, AvgGlyphs = 0.0, AvgCmd = 0.0, AvgLists = 0.0;
+    double  AvgVtxBytes = 0.0;
+};
+
+// Count every allocation made through ImGui::MemAlloc() (atlas builds allocate from worker threads)
+static std::atomic<int> g_AllocCount(0);
+static void* CountingMalloc(size_t size, void*)    { g_AllocCount++; return malloc(size); }
+static void CountingFree(void* ptr, void*)         { free(ptr); }
+
+static void MenuFrame(int, void*)
+{
+    DrawMenu();
+}
+
+static void DemoFrame(int, void*)
+{
+    ImGui::ShowDemoWindow();
+}
+
+static int CompareDouble(const void* lhs, const void* rhs)
+{
+    double a = *(const double*)lhs, b = *(const double*)rhs;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+static BenchmarkSummary Summarize(const ImVector<ImGui_ImplNull_FrameStats>& stats)
+{
+    BenchmarkSummary s;
+    if (stats.empty())
+        return s;
+    ImVector<double> times;
+    times.resize(stats.Size);
+    for (int n = 0; n < stats.Size; n++)
+    {
+        const ImGui_ImplNull_FrameStats& f = stats[n];
+        times[n] = f.FrameTimeMs;
+        s.AvgMs += f.FrameTimeMs;
+        s.AvgRenderMs += f.RenderTimeMs;
+        s.AvgVtx += f.TotalVtxCount;
+        s.AvgIdx += f.TotalIdxCount;
+        s.AvgGlyphs += f.TotalGlyphCount;
+        s.AvgCmd += f.DrawCmdCount;
+        s.AvgLists += f.CmdListsCount;
+        s.AvgVtxBytes += f.TotalVtxBytes;
+    }
+    qsort(times.Data, (size_t)times.Size, sizeof(double), CompareDouble);
+    const double inv = 1.0 / stats.Size;
+    s.AvgMs *= inv; s.AvgRenderMs *= inv;
+    s.AvgVtx *= inv; s.AvgIdx *= inv; s.AvgGlyphs *= inv; s.AvgCmd *= inv; s.AvgLists *= inv; s.AvgVtxBytes *= inv;
+    s.MinMs = times[0];
+    s.MaxMs = times.back();
+    s.P50Ms = times[times.Size / 2];
+    s.P99Ms = times[(int)((times.Size - 1) * 0.99)];
+    return s;
+}
+
+// Create a context with the same font and style as Menu.cpp (there is no embedded default font in this tree)
+static bool CreateBenchmarkContext(int width, int height)
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+
+    const char* font_filename = "HurmeGeometricSans3-Regular.ttf";
+    if (FILE* f = fopen(font_filename, "rb"))
+        fclose(f);
+    else
+    {
+        fprintf(stderr, "Could not open %s, run from the repository root.\n", font_filename);
+        ImGui::DestroyContext();
+        return false;
+    }
+    ImFontConfig config;
+    config.GlyphRanges = io.Fonts->GetGlyphRangesCyrillic();
+    config.RasterizerMultiply = 1.125f;
+    io.Fonts->AddFontFromFileTTF(font_filename, 16.0f, &config);
+    SetupMenuStyle();
+    ImGui_ImplNull_Init((float)width, (float)height);
+    return true;
+}
+
+static void DestroyBenchmarkContext()
+{
+    ImGui_ImplNull_Shutdown();
+    ImGui::DestroyContext();
+}
+
+static bool WritePPM(const char* filename, const ImU32* pixels, int width, int height)
+{
+    FILE* f = fopen(filename, "wb");
+    if (!f)
+        return false;
+    fprintf(f, "P6\n%d %d\n255\n", width, height);
+    for (int n = 0; n < width * height; n++)
+    {
+        const ImU32 c = pixels[n];
+        const unsigned char rgb[3] = { (unsigned char)(c >> IM_COL32_R_SHIFT), (unsigned char)(c >> IM_COL32_G_SHIFT), (unsigned char)(c >> IM_COL32_B_SHIFT) };
+        fwrite(rgb, 1, 3, f);
+    }
+    fclose(f);
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Suite: frames
+//-----------------------------------------------------------------------------
+
+static bool RunFrameScenario(const char* name, ImGui_ImplNull_FrameCallback ui_callback, const BenchmarkOptions& opt, int width, int height, bool merge_draw_lists, bool glyph_instances, BenchmarkSummary* out_summary)
+{
+    if (!CreateBenchmarkContext(width, height))
+        return false;
+    ImGui::GetIO().ConfigRenderMergeDrawLists = merge_draw_lists;
+    if (glyph_instances)
+    {
+        ImGui::GetIO().BackendFlags |= ImGuiBackendFlags_RendererHasGlyphInstances;
+        ImGui::GetIO().ConfigRenderGlyphInstances = true;
+    }
+
+    // Warm up: let windows settle their size, allocate their buffers, etc.
+    ImGui_ImplNull_RunFrames(10, ui_callback, NULL);
+
+    ImVector<ImGui_ImplNull_FrameStats> stats;
+    stats.resize(opt.Frames);
+    const int alloc_count = g_AllocCount;
+    ImGui_ImplNull_RunFrames(opt.Frames, ui_callback, NULL, stats.Data);
+    const int allocs = g_AllocCount - alloc_count;
+    BenchmarkSummary s = Summarize(stats);
+
+    printf("%-8s %7d %9.4f %9.4f %9.4f %9.4f %9.4f %9.4f %8.0f %8.0f %6.1f %6.1f %8.1f %6d %8.1f\n",
+        name, opt.Frames, s.AvgMs, s.MinMs, s.P50Ms, s.P99Ms, s.MaxMs, s.AvgRenderMs, s.AvgVtx, s.AvgIdx, s.AvgCmd, s.AvgLists, s.AvgVtxBytes / 1024.0,
+        allocs, ImGui::GetCurrentContext()->FrameArena.GetFrameUsage() / 1024.0);
+    *out_summary = s;
+
+    DestroyBenchmarkContext();
+    return true;
+}
+
+// Vertex buffer bytes uploaded per frame, as measured with the vertex layout of this build. The other layout can only be measured by another build:
+// its bytes are estimated from the vertex count, which doesn't depend on the layout.
+static void PrintVertexBytes(const char* name, const BenchmarkSummary& s)
+{
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    const char* layout_name = "compact";
+    const char* other_layout_name = "default";
+    const int other_vert_size = 20;
+#else
+    const char* layout_name = "default";
+    const char* other_layout_name = "compact";
+    const int other_vert_size = 12;
+#endif
+    const double other_bytes = s.AvgVtx * other_vert_size;
+    printf("%-8s vertex bytes/frame: %.0f measured with the %d-byte %s ImDrawVert, %.0f estimated with the %d-byte %s one (%+.0f%%, vertex count x %d)\n",
+        name, s.AvgVtxBytes, (int)sizeof(ImDrawVert), layout_name, other_bytes, other_vert_size, other_layout_name,
+        100.0 * (other_bytes - s.AvgVtxBytes) / (s.AvgVtxBytes > 0.0 ? s.AvgVtxBytes : 1.0), other_vert_size);
+}
+
+// Vertex + index + glyph instance bytes uploaded per frame, with text output as vertices or as glyph instances
+static void PrintGlyphInstanceBytes(const char* name, const BenchmarkSummary& vtx, const BenchmarkSummary& gi)
+{
+    const double vtx_bytes = vtx.AvgVtx * sizeof(ImDrawVert) + vtx.AvgIdx * sizeof(ImDrawIdx);
+    const double gi_bytes = gi.AvgVtx * sizeof(ImDrawVert) + gi.AvgIdx * sizeof(ImDrawIdx) + gi.AvgGlyphs * sizeof(ImDrawGlyph);
+    printf("%-8s upload bytes/frame: %.0f with text as vertices, %.0f with %.0f glyph instances (saves %.0f bytes, %.0f%%), draw calls: %.1f -> %.1f\n",
+        name, vtx_bytes, gi_bytes, gi.AvgGlyphs, vtx_bytes - gi_bytes, 100.0 * (vtx_bytes - gi_bytes) / (vtx_bytes > 0.0 ? vtx_bytes : 1.0), vtx.AvgCmd, gi.AvgCmd);
+}
+
+static bool RunFramesSuite(const BenchmarkOptions& opt)
+{
+    const int width = opt.Width ? opt.Width : 1920;
+    const int height = opt.Height ? opt.Height : 1080;
+    printf("\n[frames] %dx%d\n", width, height);
+    printf("%-8s %7s %9s %9s %9s %9s %9s %9s %8s %8s %6s %6s %8s %6s %8s\n",
+        "scenario", "frames", "avg_ms", "min_ms", "p50_ms", "p99_ms", "max_ms", "rdr_ms", "vtx", "idx", "cmds", "lists", "vtx_kb", "allocs", "arena_kb");
+    BenchmarkSummary menu, demo, menu_merged, demo_merged, menu_gi, demo_gi;
+    if (!RunFrameScenario("menu", MenuFrame, opt, width, height, false, false, &menu) || !RunFrameScenario("menu-mrg", MenuFrame, opt, width, height, true, false, &menu_merged) ||
+        !RunFrameScenario("menu-gi", MenuFrame, opt, width, height, false, true, &menu_gi) ||
+        !RunFrameScenario("demo", DemoFrame, opt, width, height, false, false, &demo) || !RunFrameScenario("demo-mrg", DemoFrame, opt, width, height, true, false, &demo_merged) ||
+        !RunFrameScenario("demo-gi", DemoFrame, opt, width, height, false, true, &demo_gi))
+        return false;
+    PrintVertexBytes("menu", menu);
+    PrintVertexBytes("demo", demo);
+    PrintGlyphInstanceBytes("menu", menu, menu_gi);
+    PrintGlyphInstanceBytes("demo", demo, demo_gi);
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Suite: soft
+//-----------------------------------------------------------------------------
+
+// Menu and demo window side by side, to cover most of the screen
+static void SoftFrame(int, void*)
+{
+    DrawMenu();
+    ImGui::SetNextWindowPos(ImVec2(ImGui::GetIO().DisplaySize.x * 0.62f, 20.0f), ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImVec2(ImGui::GetIO().DisplaySize.x * 0.36f, ImGui::GetIO().DisplaySize.y * 0.9f), ImGuiCond_Always);
+    ImGui::ShowDemoWindow();
+}
+
+static bool RunSoftScenario(const BenchmarkOptions& opt, int width, int height)
+{
+    if (!CreateBenchmarkContext(width, height))
+        return false;
+    ImGui_ImplSoft_Init(1);
+    ImGui::GetIO().ConfigRenderGlyphInstances = true;
+    ImGui_ImplNull_RunFrames(10, SoftFrame, NULL);
+    ImDrawData* draw_data = ImGui::GetDrawData();
+
+    ImVector<ImU32> framebuffer;
+    framebuffer.resize(width * height);
+    int max_threads = opt.MaxThreads;
+    if (max_threads <= 0)
+    {
+        ImGui_ImplSoft_SetThreadCount(0);
+        max_threads = ImGui_ImplSoft_GetThreadCount();
+    }
+
+    double base_ms = 0.0;
+    for (int threads = 1; threads <= max_threads; threads = (threads < max_threads && threads * 2 > max_threads) ? max_threads : threads * 2)
+    {
+        ImGui_ImplSoft_SetThreadCount(threads);
+        const int iterations = (opt.Frames / 10 > 10) ? opt.Frames / 10 : 10;
+        double total = 0.0;
+        for (int n = 0; n < iterations; n++)
+        {
+            memset(framebuffer.Data, 0, (size_t)framebuffer.size_in_bytes());
+            double t0 = ImGui_ImplNull_GetTime();
+            ImGui_ImplSoft_RenderDrawData(draw_data, framebuffer.Data, width, height, width);
+            total += ImGui_ImplNull_GetTime() - t0;
+        }
+        const double avg_ms = total * 1000.0 / iterations;
+        if (threads == 1)
+            base_ms = avg_ms;
+        printf("%-10s %7d %9.3f %8.2fx %8d %8d\n", (width >= 3840) ? "4k" : (width >= 1920) ? "1080p" : "custom", threads, avg_ms, base_ms / avg_ms, draw_data->TotalVtxCount, draw_data->TotalIdxCount / 3);
+    }
+
+    // The same frame with text output as vertices instead of glyph instances must have the same pixels
+    const int glyphs_count = draw_data->TotalGlyphCount;
+    const size_t gi_bytes = (size_t)draw_data->TotalVtxCount * sizeof(ImDrawVert) + (size_t)draw_data->TotalIdxCount * sizeof(ImDrawIdx) + (size_t)glyphs_count * sizeof(ImDrawGlyph);
+    ImGuiIO& io = ImGui::GetIO();
+    io.ConfigRenderGlyphInstances = false;
+    ImGui_ImplNull_RunFrames(1, SoftFrame, NULL);
+    const size_t vtx_bytes = (size_t)draw_data->TotalVtxCount * sizeof(ImDrawVert) + (size_t)draw_data->TotalIdxCount * sizeof(ImDrawIdx);
+    ImVector<ImU32> framebuffer_vtx;
+    framebuffer_vtx.resize(width * height);
+    memset(framebuffer_vtx.Data, 0, (size_t)framebuffer_vtx.size_in_bytes());
+    ImGui_ImplSoft_RenderDrawData(draw_data, framebuffer_vtx.Data, width, height, width);
+    const bool identical = memcmp(framebuffer.Data, framebuffer_vtx.Data, (size_t)framebuffer.size_in_bytes()) == 0;
+    io.ConfigRenderGlyphInstances = true;
+    printf("%-10s %d glyph instances: %d bytes uploaded vs %d with text as vertices, pixels %s\n", "", glyphs_count, (int)gi_bytes, (int)vtx_bytes, identical ? "identical" : "MISMATCH");
+
+    if (opt.DumpFilename)
+        WritePPM(opt.DumpFilename, framebuffer.Data, width, height);
+    ImGui_ImplSoft_Shutdown();
+    DestroyBenchmarkContext();
+    return identical;
+}
+
+static bool RunSoftSuite(const BenchmarkOptions& opt)
+{
+    printf("\n[soft] software rasterizer\n");
+    printf("%-10s %7s %9s %9s %8s %8s\n", "target", "threads", "avg_ms", "speedup", "vtx", "tris");
+    if (opt.Width > 0 && opt.Height > 0)
+        return RunSoftScenario(opt, opt.Width, opt.Height);
+    return RunSoftScenario(opt, 1920, 1080) && RunSoftScenario(opt, 3840, 2160);
+}
+
+//-----------------------------------------------------------------------------
+// Suite: replay
+//-----------------------------------------------------------------------------
+
+static bool RunReplaySuite(const BenchmarkOptions& opt)
+{
+    const int width = opt.Width ? opt.Width : 1920;
+    const int height = opt.Height ? opt.Height : 1080;
+    const char* capture_filename = opt.CaptureFilename ? opt.CaptureFilename : "Benchmark_capture.imdc";
+    printf("\n[replay] %dx%d, %s\n", width, height, capture_filename);
+    if (!CreateBenchmarkContext(width, height))
+        return false;
+    ImGui_ImplSoft_Init(opt.MaxThreads);
+    ImGui_ImplNull_RunFrames(10, SoftFrame, NULL);
+
+    // Record: live UI + null renderer, keeping the time of the live frames as the reference
+    ImGuiCaptureWriter writer;
+    if (!writer.Open(capture_filename))
+    {
+        fprintf(stderr, "Could not create %s\n", capture_filename);
+        ImGui_ImplSoft_Shutdown();
+        DestroyBenchmarkContext();
+        return false;
+    }
+    double live_ms = 0.0;
+    for (int n = 0; n < opt.Frames; n++)
+    {
+        double t0 = ImGui_ImplNull_GetTime();
+        ImGui_ImplNull_NewFrame();
+        ImGui::NewFrame();
+        SoftFrame(n, NULL);
+        ImGui::Render();
+        ImGui_ImplNull_RenderDrawData(ImGui::GetDrawData());
+        live_ms += (ImGui_ImplNull_GetTime() - t0) * 1000.0;
+        writer.WriteFrame(ImGui::GetDrawData());
+    }
+    writer.Close();
+
+    // Live soft rendering of the last frame, to validate the replay output
+    ImVector<ImU32> live_framebuffer, replay_framebuffer;
+    live_framebuffer.resize(width * height);
+    replay_framebuffer.resize(width * height);
+    memset(live_framebuffer.Data, 0, (size_t)live_framebuffer.size_in_bytes());
+    ImGui_ImplSoft_RenderDrawData(ImGui::GetDrawData(), live_framebuffer.Data, width, height, width);
+
+    // Replay. We are in the recording process so texture identifiers are still valid.
+    ImGuiCaptureReader reader;
+    double t0 = ImGui_ImplNull_GetTime();
+    if (!reader.Open(capture_filename) || reader.GetFramesCount() != opt.Frames)
+    {
+        fprintf(stderr, "Could not read back %s\n", capture_filename);
+        ImGui_ImplSoft_Shutdown();
+        DestroyBenchmarkContext();
+        return false;
+    }
+    const double open_ms = (ImGui_ImplNull_GetTime() - t0) * 1000.0;
+    const double file_mb = (double)reader.MappedSize / (1024.0 * 1024.0);
+
+    t0 = ImGui_ImplNull_GetTime();
+    for (int n = 0; n < reader.GetFramesCount(); n++)
+        ImGui_ImplNull_RenderDrawData(reader.GetFrame(n));
+    const double replay_null_ms = (ImGui_ImplNull_GetTime() - t0) * 1000.0;
+
+    const int soft_frames = (reader.GetFramesCount() < 100) ? reader.GetFramesCount() : 100;
+    double replay_soft_ms = 0.0;
+    for (int n = reader.GetFramesCount() - soft_frames; n < reader.GetFramesCount(); n++)
+    {
+        ImDrawData* draw_data = reader.GetFrame(n);
+        memset(replay_framebuffer.Data, 0, (size_t)replay_framebuffer.size_in_bytes());
+        t0 = ImGui_ImplNull_GetTime();
+        ImGui_ImplSoft_RenderDrawData(draw_data, replay_framebuffer.Data, width, height, width);
+        replay_soft_ms += (ImGui_ImplNull_GetTime() - t0) * 1000.0;
+    }
+    const bool identical = memcmp(live_framebuffer.Data, replay_framebuffer.Data, (size_t)live_framebuffer.size_in_bytes()) == 0;
+
+    printf("%-16s %9s %12s %10s\n", "pass", "frames", "avg_ms", "fps");
+    printf("%-16s %9d %12.4f %10.0f\n", "live+null", opt.Frames, live_ms / opt.Frames, opt.Frames * 1000.0 / live_ms);
+    printf("%-16s %9d %12.4f %10.0f\n", "replay+null", opt.Frames, replay_null_ms / opt.Frames, opt.Frames * 1000.0 / replay_null_ms);
+    printf("%-16s %9d %12.4f %10.0f\n", "replay+soft", soft_frames, replay_soft_ms / soft_frames, soft_frames * 1000.0 / replay_soft_ms);
+    printf("capture: %.2f MB (%.1f KB/frame), mapped and indexed in %.3f ms, last frame %s live rendering\n",
+        file_mb, file_mb * 1024.0 / opt.Frames, open_ms, identical ? "matches" : "DIFFERS FROM");
+
+    if (opt.DumpFilename)
+        WritePPM(opt.DumpFilename, replay_framebuffer.Data, width, height);
+    reader.Close();
+    if (opt.CaptureFilename == NULL)
+        remove(capture_filename);
+    ImGui_ImplSoft_Shutdown();
+    DestroyBenchmarkContext();
+    return identical;
+}
+
+//-----------------------------------------------------------------------------
+// Suite: input
+//-----------------------------------------------------------------------------
+
+// Scripted interaction with the menu, in phases of 60 frames: hover sweep + mouse wheel, click on a tab, slider drag, typing.
+// Positions are derived from the menu window and tab bar of the previous frame, so the session is the same at any display size.
+static void ScriptMenuInputs(int frame_n, ImGuiIO& io)
+{
+    io.MouseDown[0] = false;
+    io.MouseWheel = 0.0f;
+    ImGuiWindow* window = ImGui::FindWindowByName("Unicore");
+    if (window == NULL)
+        return;
+    const ImVec2 pos = window->Pos, size = window->Size;
+    const int phase = (frame_n / 60) % 4, local = frame_n % 60;
+    if (phase == 0)
+    {
+        // Hover: zigzag over the window contents
+        io.MousePos = ImVec2(pos.x + size.x * (local / 60.0f), pos.y + size.y * (0.2f + 0.6f * ((local % 20) / 20.0f)));
+        io.MouseWheel = (local == 30) ? -1.0f : (local == 45) ? 1.0f : 0.0f;
+    }
+    else if (phase == 1)
+    {
+        // Click: cycle through the top level tabs
+        ImGuiTabBar* tab_bar = ImGui::GetCurrentContext()->TabBars.GetByKey(window->GetIDNoKeepAlive("###1"));
+        if (tab_bar == NULL || tab_bar->Tabs.Size == 0)
+            return;
+        const ImGuiTabItem& tab = tab_bar->Tabs[(frame_n / 240) % tab_bar->Tabs.Size];
+        io.MousePos = ImVec2(tab_bar->BarRect.Min.x + tab.Offset - tab_bar->ScrollingAnim + tab.Width * 0.5f, (tab_bar->BarRect.Min.y + tab_bar->BarRect.Max.y) * 0.5f);
+        io.MouseDown[0] = (local >= 10 && local < 13);
+    }
+    else if (phase == 2)
+    {
+        // Drag: press in the left column and move right (hits the first slider of the Player tab)
+        const float t = (local < 5) ? 0.0f : (local > 40) ? 1.0f : (local - 5) / 35.0f;
+        io.MousePos = ImVec2(pos.x + size.x * (0.2f + 0.2f * t), pos.y + size.y * 0.3f);
+        io.MouseDown[0] = (local >= 5 && local < 45);
+    }
+    else
+    {
+        // Type: click below the drag point (first text field of the Player tab), type a word then erase it
+        static const char text[] = "benchmark";
+        io.MousePos = ImVec2(pos.x + size.x * 0.2f, pos.y + size.y * 0.34f);
+        io.MouseDown[0] = (local >= 2 && local < 4);
+        if (local >= 6 && local < 6 + (IM_ARRAYSIZE(text) - 1) * 3 && (local - 6) % 3 == 0)
+            io.AddInputCharacter(text[(local - 6) / 3]);
+        io.KeysDown[io.KeyMap[ImGuiKey_Backspace]] = (local >= 40 && local < 50 && (local & 1) == 0);
+    }
+}
+
+// Hash the content of the draw data, so a replayed frame can be compared with the recorded one
+static ImU32 HashDrawData(const ImDrawData* draw_data, ImU32 seed)
+{
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+            const ImU32 fields[3] = { pcmd->VtxOffset, pcmd->IdxOffset, pcmd->ElemCount };
+            seed = ImHashData(&pcmd->ClipRect, sizeof(pcmd->ClipRect), seed);
+            seed = ImHashData(fields, sizeof(fields), seed);
+        }
+        seed = ImHashData(cmd_list->VtxBuffer.Data, (size_t)cmd_list->VtxBuffer.size_in_bytes(), seed);
+        seed = ImHashData(cmd_list->IdxBuffer.Data, (size_t)cmd_list->IdxBuffer.size_in_bytes(), seed);
+    }
+    return seed;
+}
+
+// Subsystems and windows which allocated during the current frame
+static void PrintFrameAllocations()
+{
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+    ImGuiContext& g = *ImGui::GetCurrentContext();
+    for (int n = 0; n < ImGuiAllocTag_COUNT; n++)
+        if (g.AllocStats[n].FrameAllocCount > 0)
+            printf("  %-10s %d allocations, %d bytes\n", ImGui::DebugGetAllocTagName((ImGuiAllocTag)n), g.AllocStats[n].FrameAllocCount, (int)g.AllocStats[n].FrameAllocBytes);
+    for (int n = 0; n < g.AllocWindows.Size; n++)
+        if (g.AllocWindows[n]->AllocStats.FrameAllocCount > 0)
+            printf("  window '%s': %d allocations, %d bytes\n", g.AllocWindows[n]->Name, g.AllocWindows[n]->AllocStats.FrameAllocCount, (int)g.AllocWindows[n]->AllocStats.FrameAllocBytes);
+#endif
+}
+
+static bool RunInputSuite(const BenchmarkOptions& opt)
+{
+    const char* inputs_filename = opt.InputsFilename ? opt.InputsFilename : "Benchmark_inputs.imir";
+    ImGuiInputPlayer player;
+    ImGuiInputRecorder recorder;
+    const bool replaying = player.Open(inputs_filename) && player.GetFramesCount() > 0;
+    const int frames_count = replaying ? player.GetFramesCount() : opt.Frames;
+    const int width = replaying ? (int)player.Frames[0].DisplaySize[0] : opt.Width ? opt.Width : 1920;
+    const int height = replaying ? (int)player.Frames[0].DisplaySize[1] : opt.Height ? opt.Height : 1080;
+    printf("\n[input] %s %s, %d frames, %dx%d\n", replaying ? "replaying" : "recording", inputs_filename, frames_count, width, height);
+    if (!CreateBenchmarkContext(width, height))
+        return false;
+    if (!replaying && !recorder.Open(inputs_filename))
+    {
+        fprintf(stderr, "Could not create %s\n", inputs_filename);
+        DestroyBenchmarkContext();
+        return false;
+    }
+
+    // No warm-up: the session must start from a fresh context to be reproducible
+    ImGuiIO& io = ImGui::GetIO();
+    ImVector<ImGui_ImplNull_FrameStats> stats;
+    ImVector<int> allocs;
+    stats.resize(frames_count);
+    allocs.resize(frames_count);
+    ImU32 checksum = 0;
+    for (int n = 0; n < frames_count; n++)
+    {
+        const int alloc_count = g_AllocCount;
+        double t0 = ImGui_ImplNull_GetTime();
+        ImGui_ImplNull_NewFrame();
+        if (replaying)
+            player.ApplyFrame(n, io);
+        else
+            ScriptMenuInputs(n, io);
+        if (recorder.File)
+            recorder.RecordFrame(io);
+        ImGui::NewFrame();
+        DrawMenu();
+        ImGui::Render();
+        ImGui_ImplNull_RenderDrawData(ImGui::GetDrawData());
+        double t1 = ImGui_ImplNull_GetTime();
+        stats[n] = *ImGui_ImplNull_GetLastRenderStats();
+        stats[n].FrameTimeMs = (t1 - t0) * 1000.0;
+        allocs[n] = g_AllocCount - alloc_count;
+        checksum = HashDrawData(ImGui::GetDrawData(), checksum);
+    }
+    recorder.Close();
+
+    BenchmarkSummary s = Summarize(stats);
+    int allocs_total = 0, allocs_max = 0;
+    for (int n = 0; n < allocs.Size; n++)
+    {
+        allocs_total += allocs[n];
+        allocs_max = (allocs[n] > allocs_max) ? allocs[n] : allocs_max;
+    }
+    printf("%7s %9s %9s %9s %9s %8s %8s %6s %9s %9s\n", "frames", "avg_ms", "p50_ms", "p99_ms", "max_ms", "vtx", "idx", "cmds", "allocs", "max_alloc");
+    printf("%7d %9.4f %9.4f %9.4f %9.4f %8.0f %8.0f %6.1f %9d %9d\n",
+        frames_count, s.AvgMs, s.P50Ms, s.P99Ms, s.MaxMs, s.AvgVtx, s.AvgIdx, s.AvgCmd, allocs_total, allocs_max);
+    printf("session checksum: %08X\n", checksum);
+    if (!replaying)
+        printf("replay with: %s input --inputs %s\n", "./Benchmark", inputs_filename);
+
+    // Replay the session in the same context: every buffer has grown during the first pass, so these steady-state frames must not allocate
+    int allocating_frames = 0;
+    for (int n = 0; n < frames_count; n++)
+    {
+        const int alloc_count = g_AllocCount;
+        ImGui_ImplNull_NewFrame();
+        if (replaying)
+            player.ApplyFrame(n, io);
+        else
+            ScriptMenuInputs(n, io);
+        ImGui::NewFrame();
+        DrawMenu();
+        ImGui::Render();
+        ImGui_ImplNull_RenderDrawData(ImGui::GetDrawData());
+        const int frame_allocs = g_AllocCount - alloc_count;
+        if (frame_allocs == 0)
+            continue;
+        if (allocating_frames++ < 10)
+        {
+            printf("steady state: frame %d made %d allocations\n", n, frame_allocs);
+            PrintFrameAllocations();
+        }
+    }
+    printf("steady state: %d frames replayed, %d allocating: %s\n", frames_count, allocating_frames, allocating_frames == 0 ? "OK" : "FAILED");
+    DestroyBenchmarkContext();
+    return allocating_frames == 0;
+}
+
+//-----------------------------------------------------------------------------
+// Suite: idle
+//-----------------------------------------------------------------------------
+
+// Input event at a given time. Positions are relative to the menu window.
+enum IdleEventType { IdleEventType_MouseMove, IdleEventType_MouseDown, IdleEventType_MouseUp, IdleEventType_Char };
+struct IdleEvent
+{
+    double          Time;
+    IdleEventType   Type;
+    ImVec2          Pos;
+    char            Char;
+};
+
+// Mock clock: waiting returns as soon as the next scripted event is due, rendering a frame takes FrameTime
+struct IdleMockClock
+{
+    double                      Time = 0.0;
+    double                      FrameTime = 1.0 / 60.0;
+    const ImVector<IdleEvent>*  Events = NULL;
+    int                         NextEvent = 0;
+};
+
+static double IdleMockClock_GetTime(void* user_data)
+{
+    return ((IdleMockClock*)user_data)->Time;
+}
+
+static bool IdleMockClock_WaitEvents(void* user_data, double timeout)
+{
+    IdleMockClock* clock = (IdleMockClock*)user_data;
+    if (clock->NextEvent < clock->Events->Size && (*clock->Events)[clock->NextEvent].Time <= clock->Time + timeout)
+    {
+        if (clock->Time < (*clock->Events)[clock->NextEvent].Time)
+            clock->Time = (*clock->Events)[clock->NextEvent].Time;
+        return true;
+    }
+    clock->Time += timeout;
+    return false;
+}
+
+// 20 seconds: hover, drag a slider, click into a text field and type, click away, with idle periods in between
+static void BuildIdleSession(ImVector<IdleEvent>* events)
+{
+    static const char text[] = "benchmark";
+    const IdleEvent hover_start = { 2.0, IdleEventType_MouseMove, ImVec2(0.1f, 0.5f), 0 };
+    events->push_back(hover_start);
+    for (int n = 1; n <= 30; n++)
+    {
+        const IdleEvent e = { 2.0 + n / 60.0, IdleEventType_MouseMove, ImVec2(0.1f + 0.8f * n / 30.0f, 0.5f), 0 };
+        events->push_back(e);
+    }
+    const IdleEvent drag_start[] = { { 4.0, IdleEventType_MouseMove, ImVec2(0.2f, 0.3f), 0 }, { 4.1, IdleEventType_MouseDown, ImVec2(0.2f, 0.3f), 0 } };
+    events->push_back(drag_start[0]);
+    events->push_back(drag_start[1]);
+    for (int n = 1; n <= 30; n++)
+    {
+        const IdleEvent e = { 4.1 + n / 60.0, IdleEventType_MouseMove, ImVec2(0.2f + 0.2f * n / 30.0f, 0.3f), 0 };
+        events->push_back(e);
+    }
+    const IdleEvent clicks[] =
+    {
+        { 4.7, IdleEventType_MouseUp, ImVec2(0.4f, 0.3f), 0 },
+        { 6.0, IdleEventType_MouseMove, ImVec2(0.2f, 0.34f), 0 },
+        { 6.05, IdleEventType_MouseDown, ImVec2(0.2f, 0.34f), 0 },
+        { 6.1, IdleEventType_MouseUp, ImVec2(0.2f, 0.34f), 0 },
+    };
+    for (int n = 0; n < IM_ARRAYSIZE(clicks); n++)
+        events->push_back(clicks[n]);
+    for (int n = 0; n < IM_ARRAYSIZE(text) - 1; n++)
+    {
+        const IdleEvent e = { 7.0 + n * 0.1, IdleEventType_Char, ImVec2(0.2f, 0.34f), text[n] };
+        events->push_back(e);
+    }
+    const IdleEvent click_away[] =
+    {
+        { 10.0, IdleEventType_MouseMove, ImVec2(0.95f, 0.95f), 0 },
+        { 10.05, IdleEventType_MouseDown, ImVec2(0.95f, 0.95f), 0 },
+        { 10.1, IdleEventType_MouseUp, ImVec2(0.95f, 0.95f), 0 },
+    };
+    for (int n = 0; n < IM_ARRAYSIZE(click_away); n++)
+        events->push_back(click_away[n]);
+}
+
+static void ApplyIdleEvent(const IdleEvent& e, ImGuiIO& io)
+{
+    ImGuiWindow* window = ImGui::FindWindowByName("Unicore");
+    if (window == NULL)
+        return;
+    io.MousePos = ImVec2(window->Pos.x + window->Size.x * e.Pos.x, window->Pos.y + window->Size.y * e.Pos.y);
+    if (e.Type == IdleEventType_MouseDown || e.Type == IdleEventType_MouseUp)
+        io.MouseDown[0] = (e.Type == IdleEventType_MouseDown);
+    else if (e.Type == IdleEventType_Char)
+        io.AddInputCharacter((unsigned int)e.Char);
+}
+
+// Run the session with the scheduler, or at a fixed 60 Hz when 'scheduler' is NULL. Return the number of frames rendered.
+static int RunIdleSession(const ImVector<IdleEvent>& events, double duration, ImGuiFrameScheduler* scheduler, ImU32* out_last_frame_checksum, int* out_event_wake_ups)
+{
+    IdleMockClock clock;
+    clock.Events = &events;
+    if (scheduler)
+    {
+        scheduler->GetTimeFn = IdleMockClock_GetTime;
+        scheduler->WaitEventsFn = IdleMockClock_WaitEvents;
+        scheduler->UserData = &clock;
+        scheduler->MaxWaitTime = FLT_MAX;   // The mock clock wakes up on every input: nothing to poll
+    }
+
+    ImGuiIO& io = ImGui::GetIO();
+    double last_frame_time = -clock.FrameTime;
+    int frames_count = 0;
+    for (;;)
+    {
+        if (scheduler)
+            scheduler->WaitForNextFrame();
+        if (clock.Time >= duration)
+            break;
+        ImGui_ImplNull_NewFrame();
+        io.DeltaTime = (float)(clock.Time - last_frame_time);
+        last_frame_time = clock.Time;
+        while (clock.NextEvent < events.Size && events[clock.NextEvent].Time <= clock.Time)
+            ApplyIdleEvent(events[clock.NextEvent++], io);
+        ImGui::NewFrame();
+        DrawMenu();
+        ImGui::Render();
+        ImGui_ImplNull_RenderDrawData(ImGui::GetDrawData());
+        frames_count++;
+        clock.Time += clock.FrameTime;
+        if (scheduler)
+            scheduler->FrameRendered();
+    }
+    *out_last_frame_checksum = HashDrawData(ImGui::GetDrawData(), 0);
+    *out_event_wake_ups = scheduler ? scheduler->EventWakeUpsCount : 0;
+    return frames_count;
+}
+
+static bool RunIdleSuite(const BenchmarkOptions& opt)
+{
+    const int width = opt.Width ? opt.Width : 1920;
+    const int height = opt.Height ? opt.Height : 1080;
+    const double duration = 20.0;
+    printf("\n[idle] %dx%d, %.0f s scripted session, mock clock\n", width, height, duration);
+    ImVector<IdleEvent> events;
+    BuildIdleSession(&events);
+
+    ImU32 checksum_continuous = 0, checksum_scheduled = 0;
+    int event_wake_ups = 0;
+    if (!CreateBenchmarkContext(width, height))
+        return false;
+    const int frames_continuous = RunIdleSession(events, duration, NULL, &checksum_continuous, &event_wake_ups);
+    DestroyBenchmarkContext();
+
+    ImGuiFrameScheduler scheduler;
+    if (!CreateBenchmarkContext(width, height))
+        return false;
+    const int frames_scheduled = RunIdleSession(events, duration, &scheduler, &checksum_scheduled, &event_wake_ups);
+    DestroyBenchmarkContext();
+
+    printf("%d input events\n", events.Size);
+    printf("%-10s %7s %9s %9s\n", "loop", "frames", "wake_ups", "saved");
+    printf("%-10s %7d %9s %8.1f%%\n", "60hz", frames_continuous, "-", 0.0);
+    printf("%-10s %7d %9d %8.1f%%\n", "scheduled", frames_scheduled, event_wake_ups, 100.0 * (frames_continuous - frames_scheduled) / frames_continuous);
+    const bool match = (checksum_continuous == checksum_scheduled);
+    printf("last frame: %08X (60 Hz) vs %08X (scheduled), %s\n", checksum_continuous, checksum_scheduled, match ? "match" : "MISMATCH");
+    return match;
+}
+
+//-----------------------------------------------------------------------------
+// Suite: atlas
+//-----------------------------------------------------------------------------
+
+// ImFontAtlas::BuildParallelForFn: run the work items on 'user_data' threads including the caller's.
+// Threads are created for each call, Build() only makes two calls.
+static void AtlasBuildParallelFor(void* user_data, int items_count, void (*item_fn)(void* item_arg, int item_n), void* item_arg)
+{
+    const int threads_count = ImMin(*(const int*)user_data, items_count);
+    std::atomic<int> next_item(0);
+    auto run_items = [&]()
+    {
+        for (int item_n = next_item.fetch_add(1); item_n < items_count; item_n = next_item.fetch_add(1))
+            item_fn(item_arg, item_n);
+    };
+    std::thread* workers = new std::thread[threads_count - 1];
+    for (int n = 0; n < threads_count - 1; n++)
+        workers[n] = std::thread(run_items);
+    run_items();
+    for (int n = 0; n < threads_count - 1; n++)
+        workers[n].join();
+    delete[] workers;
+}
+
+struct AtlasBuildFontData
+{
+    ImVector<char>  MenuFont;
+    ImVector<char>  ExtraFont;          // --font
+};
+
+static bool LoadFileData(const char* filename, ImVector<char>* out_data)
+{
+    FILE* f = fopen(filename, "rb");
+    if (f == NULL)
+        return false;
+    fseek(f, 0, SEEK_END);
+    out_data->resize((int)ftell(f));
+    fseek(f, 0, SEEK_SET);
+    const bool ok = fread(out_data->Data, 1, (size_t)out_data->Size, f) == (size_t)out_data->Size;
+    fclose(f);
+    return ok;
+}
+
+// Menu font at several sizes, one of them with RasterizerMultiply as in Menu.cpp, and the extra font merged into two of them
+static void AddAtlasBuildFonts(ImFontAtlas* atlas, AtlasBuildFontData& data)
+{
+    static const float sizes[] = { 13.0f, 16.0f, 20.0f, 24.0f, 32.0f };
+    for (int n = 0; n < IM_ARRAYSIZE(sizes); n++)
+    {
+        ImFontConfig config;
+        config.FontDataOwnedByAtlas = false;
+        config.GlyphRanges = atlas->GetGlyphRangesCyrillic();
+        config.RasterizerMultiply = (sizes[n] == 16.0f) ? 1.125f : 1.0f;
+        atlas->AddFontFromMemoryTTF(data.MenuFont.Data, data.MenuFont.Size, sizes[n], &config);
+        if (data.ExtraFont.empty() || (sizes[n] != 16.0f && sizes[n] != 20.0f))
+            continue;
+        ImFontConfig extra_config;
+        extra_config.FontDataOwnedByAtlas = false;
+        extra_config.MergeMode = true;
+        extra_config.OversampleH = 1;
+        extra_config.GlyphRanges = atlas->GetGlyphRangesChineseFull();
+        atlas->AddFontFromMemoryTTF(data.ExtraFont.Data, data.ExtraFont.Size, sizes[n], &extra_config);
+    }
+}
+
+template<typename T>
+static bool CompareVectors(const ImVector<T>& a, const ImVector<T>& b)
+{
+    return a.Size == b.Size && memcmp(a.Data, b.Data, (size_t)a.size_in_bytes()) == 0;
+}
+
+// Compare everything the build outputs
+static bool CompareAtlasOutput(const ImFontAtlas& a, const ImFontAtlas& b)
+{
+    if (a.TexWidth != b.TexWidth || a.TexHeight != b.TexHeight || a.Fonts.Size != b.Fonts.Size || a.CustomRects.Size != b.CustomRects.Size)
+        return false;
+    if (memcmp(a.TexPixelsAlpha8, b.TexPixelsAlpha8, (size_t)(a.TexWidth * a.TexHeight)) != 0 || memcmp(&a.TexUvWhitePixel, &b.TexUvWhitePixel, sizeof(a.TexUvWhitePixel)) != 0 || memcmp(a.TexUvLines, b.TexUvLines, sizeof(a.TexUvLines)) != 0)
+        return false;
+    for (int n = 0; n < a.CustomRects.Size; n++)
+        if (a.CustomRects[n].X != b.CustomRects[n].X || a.CustomRects[n].Y != b.CustomRects[n].Y)
+            return false;
+    for (int n = 0; n < a.Fonts.Size; n++)
+    {
+        const ImFont* fa = a.Fonts[n];
+        const ImFont* fb = b.Fonts[n];
+        if (!CompareVectors(fa->Glyphs, fb->Glyphs) || !CompareVectors(fa->IndexAdvanceX, fb->IndexAdvanceX) || !CompareVectors(fa->IndexLookup, fb->IndexLookup) ||
+            !CompareVectors(fa->IndexPagesAdvanceX, fb->IndexPagesAdvanceX) || !CompareVectors(fa->IndexPagesLookup, fb->IndexPagesLookup) || memcmp(fa->IndexPagesBlock, fb->IndexPagesBlock, sizeof(fa->IndexPagesBlock)) != 0)
+            return false;
+        if (fa->FontSize != fb->FontSize || fa->Ascent != fb->Ascent || fa->Descent != fb->Descent || fa->FallbackAdvanceX != fb->FallbackAdvanceX || fa->EllipsisChar != fb->EllipsisChar ||
+            fa->MetricsTotalSurface != fb->MetricsTotalSurface || fa->ConfigDataCount != fb->ConfigDataCount || memcmp(fa->Used4kPagesMap, fb->Used4kPagesMap, sizeof(fa->Used4kPagesMap)) != 0)
+            return false;
+        if ((fa->FallbackGlyph ? fa->FallbackGlyph - fa->Glyphs.Data : -1) != (fb->FallbackGlyph ? fb->FallbackGlyph - fb->Glyphs.Data : -1))
+            return false;
+    }
+    return true;
+}
+
+// Startup with the menu font as in CreateBenchmarkContext(): without cache, cold (build + save), warm (load)
+static bool RunAtlasCacheScenario(const BenchmarkOptions& opt)
+{
+    const char* font_filename = "HurmeGeometricSans3-Regular.ttf";
+    const char* cache_filename = "Benchmark_atlas.cache";
+    remove(cache_filename);
+    printf("%-10s %9s %10s\n", "startup", "avg_ms", "output");
+
+    ImFontAtlas reference;
+    ImFontConfig reference_config;
+    reference_config.GlyphRanges = reference.GetGlyphRangesCyrillic();
+    reference_config.RasterizerMultiply = 1.125f;
+    if (!reference.AddFontFromFileTTF(font_filename, 16.0f, &reference_config) || !reference.Build())
+        return false;
+    const int iterations = (opt.Frames / 100 > 3) ? opt.Frames / 100 : 3;
+    bool all_identical = true;
+    for (int mode = 0; mode < 3; mode++)
+    {
+        double total = 0.0;
+        bool identical = true;
+        for (int n = 0; n < iterations; n++)
+        {
+            if (mode == 1)
+                remove(cache_filename);
+            ImFontAtlas atlas;
+            double t0 = ImGui_ImplNull_GetTime();
+            ImFontConfig config;
+            config.GlyphRanges = atlas.GetGlyphRangesCyrillic();
+            config.RasterizerMultiply = 1.125f;
+            atlas.AddFontFromFileTTF(font_filename, 16.0f, &config);
+            bool loaded = false;
+            if (mode == 0)
+                atlas.Build();
+            else if (mode == 1)
+                ImFontAtlasCache_LoadOrBuild(&atlas, cache_filename);
+            else
+                loaded = ImFontAtlasCache_Load(&atlas, cache_filename);
+            total += ImGui_ImplNull_GetTime() - t0;
+            identical &= (mode != 2 || loaded) && CompareAtlasOutput(atlas, reference);
+        }
+        printf("%-10s %9.3f %10s\n", mode == 0 ? "no cache" : mode == 1 ? "cold" : "warm", total * 1000.0 / iterations, identical ? "identical" : "MISMATCH");
+        all_identical &= identical;
+    }
+    remove(cache_filename);
+    return all_identical;
+}
+
+// Default ranges baked, merged with every other glyph of the menu font, or of --font
+static void AddAtlasOnDemandFonts(ImFontAtlas* atlas, AtlasBuildFontData& data, bool on_demand)
+{
+    static const ImWchar full_ranges[] = { 0x0020, 0xFFFF, 0 };
+    ImFontConfig config;
+    config.FontDataOwnedByAtlas = false;
+    config.RasterizerMultiply = 1.125f;
+    atlas->AddFontFromMemoryTTF(data.MenuFont.Data, data.MenuFont.Size, 16.0f, &config);
+    ImFontConfig large_config;
+    large_config.FontDataOwnedByAtlas = false;
+    large_config.MergeMode = true;
+    large_config.GlyphsOnDemand = on_demand;
+    large_config.GlyphRanges = full_ranges;
+    if (data.ExtraFont.empty())
+    {
+        large_config.RasterizerMultiply = 1.125f;
+        atlas->AddFontFromMemoryTTF(data.MenuFont.Data, data.MenuFont.Size, 16.0f, &large_config);
+    }
+    else
+    {
+        large_config.OversampleH = 1;
+        atlas->AddFontFromMemoryTTF(data.ExtraFont.Data, data.ExtraFont.Size, 16.0f, &large_config);
+    }
+}
+
+// An on-demand glyph must have the quad and the pixels of its baked version, only its UV differ
+static bool CompareOnDemandGlyph(const ImFontAtlas& atlas, const ImFontGlyph* glyph, const ImFontAtlas& baked_atlas, const ImFontGlyph* baked_glyph, bool empty)
+{
+    if (glyph->AdvanceX != baked_glyph->AdvanceX)
+        return false;
+    const int baked_x = (int)(baked_glyph->U0 * baked_atlas.TexWidth + 0.5f), baked_y = (int)(baked_glyph->V0 * baked_atlas.TexHeight + 0.5f);
+    const int w = (int)((baked_glyph->U1 - baked_glyph->U0) * baked_atlas.TexWidth + 0.5f), h = (int)((baked_glyph->V1 - baked_glyph->V0) * baked_atlas.TexHeight + 0.5f);
+    if (empty)
+    {
+        // Nothing to rasterize: Build() packs a blank rect
+        for (int y = 0; y < h; y++)
+            for (int x = 0; x < w; x++)
+                if (baked_atlas.TexPixelsAlpha8[baked_x + x + (baked_y + y) * baked_atlas.TexWidth] != 0)
+                    return false;
+        return true;
+    }
+    if (glyph->X0 != baked_glyph->X0 || glyph->Y0 != baked_glyph->Y0 || glyph->X1 != baked_glyph->X1 || glyph->Y1 != baked_glyph->Y1)
+        return false;
+    const int x0 = (int)(glyph->U0 * atlas.TexWidth + 0.5f), y0 = (int)(glyph->V0 * atlas.TexHeight + 0.5f);
+    if (w != (int)((glyph->U1 - glyph->U0) * atlas.TexWidth + 0.5f) || h != (int)((glyph->V1 - glyph->V0) * atlas.TexHeight + 0.5f))
+        return false;
+    for (int y = 0; y < h; y++)
+        if (memcmp(atlas.TexPixelsAlpha8 + x0 + (y0 + y) * atlas.TexWidth, baked_atlas.TexPixelsAlpha8 + baked_x + (baked_y + y) * baked_atlas.TexWidth, (size_t)w) != 0)
+            return false;
+    return true;
+}
+
+// Bake every glyph vs rasterize them on demand: startup time and texture size. Then a session with a small page budget,
+// drawing a sliding window of glyphs each frame (loads and evictions) and once more glyphs than the budget holds (deferred glyphs).
+static bool RunAtlasOnDemandScenario(const BenchmarkOptions& opt, AtlasBuildFontData& data)
+{
+    const int iterations = (opt.Frames / 100 > 3) ? opt.Frames / 100 : 3;
+    printf("%-10s %9s %9s\n", "glyphs", "avg_ms", "tex_kb");
+    for (int on_demand = 0; on_demand < 2; on_demand++)
+    {
+        double total = 0.0;
+        int tex_size = 0;
+        for (int n = 0; n < iterations; n++)
+        {
+            ImFontAtlas atlas;
+            AddAtlasOnDemandFonts(&atlas, data, on_demand != 0);
+            double t0 = ImGui_ImplNull_GetTime();
+            atlas.Build();
+            total += ImGui_ImplNull_GetTime() - t0;
+            tex_size = atlas.TexWidth * atlas.TexHeight;
+        }
+        printf("%-10s %9.3f %9d\n", on_demand ? "on demand" : "baked", total * 1000.0 / iterations, tex_size / 1024);
+    }
+
+    ImFontAtlas baked;
+    AddAtlasOnDemandFonts(&baked, data, false);
+    baked.Build();
+    ImFontAtlas atlas;
+    atlas.Flags |= ImFontAtlasFlags_NoPowerOfTwoHeight;    // Small budget: no extra pages from rounding the height up
+    atlas.DynamicPageSize = 128;
+    atlas.DynamicPagesCount = 2;
+    AddAtlasOnDemandFonts(&atlas, data, true);
+    unsigned char* pixels;
+    int width, height;
+    atlas.GetTexDataAsRGBA32(&pixels, &width, &height);     // Also check the RGBA32 mirror
+
+    // Codepoints of the on-demand glyphs
+    ImFont* font = atlas.Fonts[0];
+    ImVector<ImWchar> codepoints;
+    for (int n = 0; n < font->DynamicGlyphsPage.Size; n++)
+        codepoints.push_back((ImWchar)font->Glyphs[font->DynamicGlyphsStart + n].Codepoint);
+    if (codepoints.Size == 0)
+        return false;
+
+    const int frames_count = 200;
+    const int glyphs_per_frame = 24;
+    bool identical = true;
+    size_t uploaded = 0;
+    for (int frame = 0; frame <= frames_count; frame++)
+    {
+        ImFontAtlasDynamicGlyphsNewFrame(&atlas);
+        const int count = (frame == frames_count) ? ImMin(codepoints.Size, 1000) : glyphs_per_frame;   // The last frame overflows the budget
+        for (int n = 0; n < count; n++)
+        {
+            const ImWchar c = codepoints[(frame * glyphs_per_frame / 3 + n) % codepoints.Size];
+            const ImFontGlyph* glyph = font->FindGlyph(c);
+            const int page_n = font->DynamicGlyphsPage[(int)(glyph - font->Glyphs.Data) - font->DynamicGlyphsStart];
+            if (page_n != IM_FONT_DYNAMIC_GLYPH_NOT_LOADED)
+                identical &= CompareOnDemandGlyph(atlas, glyph, baked, baked.Fonts[0]->FindGlyph(c), page_n == IM_FONT_DYNAMIC_GLYPH_EMPTY);
+        }
+        for (int n = 0; n < atlas.TexDirtyRects.Size; n++)
+            uploaded += (size_t)atlas.TexDirtyRects[n].W * atlas.TexDirtyRects[n].H;
+        atlas.TexDirtyRects.resize(0);
+    }
+    for (int n = 0; n < width * height; n++)
+        identical &= (atlas.TexPixelsRGBA32[n] >> IM_COL32_A_SHIFT) == atlas.TexPixelsAlpha8[n];
+    const ImFontAtlasDynamicGlyphs* dyn = atlas.DynamicGlyphs;
+    printf("session    %dx%d texture, %d frames, %d on-demand glyphs, %d pages of %dx%d: %d loads, %d evictions, %d deferred, %d KB uploaded, %s\n",
+        atlas.TexWidth, atlas.TexHeight, frames_count + 1, codepoints.Size, dyn->Pages.Size, dyn->PageSize, dyn->PageSize, dyn->LoadsCount, dyn->EvictionsCount, dyn->DeferredCount, (int)(uploaded / 1024), identical ? "identical" : "MISMATCH");
+    return identical;
+}
+
+// Startup font as in CreateBenchmarkContext(), then what a running application adds: a heading font and a few icons, one of them a glyph of the new font.
+// They fit in the space left free by rounding the texture height to a power of two.
+static void AddAtlasAppendBaseFont(ImFontAtlas* atlas, AtlasBuildFontData& data)
+{
+    ImFontConfig config;
+    config.FontDataOwnedByAtlas = false;
+    config.GlyphRanges = atlas->GetGlyphRangesCyrillic();
+    config.RasterizerMultiply = 1.125f;
+    atlas->AddFontFromMemoryTTF(data.MenuFont.Data, data.MenuFont.Size, 16.0f, &config);
+}
+
+static void AddAtlasAppendItems(ImFontAtlas* atlas, AtlasBuildFontData& data)
+{
+    static const ImWchar ranges[] = { 0x0020, 0x007E, 0 };
+    ImFontConfig config;
+    config.FontDataOwnedByAtlas = false;
+    ImFont* font = atlas->AddFontFromMemoryTTF(data.MenuFont.Data, data.MenuFont.Size, 20.0f, &config, ranges);
+    for (int n = 0; n < 8; n++)
+        atlas->AddCustomRectRegular(32, 32);
+    atlas->AddCustomRectFontGlyph(font, (ImWchar)0xE000, 20, 20, 22.0f);
+}
+
+// Copy what the renderer back-end would upload to 'texture': the whole texture, or only TexDirtyRects. Return the number of bytes copied.
+static size_t UploadAtlasTexture(ImFontAtlas* atlas, ImVector<ImU32>& texture, bool full)
+{
+    unsigned char* pixels;
+    int width, height;
+    atlas->GetTexDataAsRGBA32(&pixels, &width, &height);
+    size_t bytes = 0;
+    if (full)
+    {
+        texture.resize(width * height);
+        memcpy(texture.Data, pixels, (size_t)width * height * 4);
+        bytes = (size_t)width * height * 4;
+    }
+    else
+    {
+        for (int n = 0; n < atlas->TexDirtyRects.Size; n++)
+        {
+            const ImFontAtlasTexRect& r = atlas->TexDirtyRects[n];
+            for (int y = r.Y; y < r.Y + r.H; y++)
+                memcpy(texture.Data + r.X + y * width, pixels + (r.X + y * width) * 4, (size_t)r.W * 4);
+            bytes += (size_t)r.W * r.H * 4;
+        }
+    }
+    atlas->TexDirtyRects.resize(0);
+    return bytes;
+}
+
+// Add a font and custom rects to a built and uploaded atlas: full rebuild + upload of the texture vs BuildAppend() + upload of TexDirtyRects.
+// The appended font must have the glyphs of the rebuilt one, and the fonts already built must be left untouched.
+static bool RunAtlasAppendScenario(const BenchmarkOptions& opt, AtlasBuildFontData& data)
+{
+    const int iterations = (opt.Frames / 100 > 3) ? opt.Frames / 100 : 3;
+    printf("%-10s %9s %10s %10s\n", "add font", "avg_ms", "upload_kb", "output");
+
+    ImFontAtlas rebuilt;
+    AddAtlasAppendBaseFont(&rebuilt, data);
+    AddAtlasAppendItems(&rebuilt, data);
+    rebuilt.Build();
+
+    bool all_identical = true;
+    for (int append = 0; append < 2; append++)
+    {
+        double total = 0.0;
+        size_t uploaded = 0;
+        bool identical = true;
+        for (int n = 0; n < iterations; n++)
+        {
+            ImFontAtlas atlas;
+            ImVector<ImU32> texture;
+            AddAtlasAppendBaseFont(&atlas, data);
+            UploadAtlasTexture(&atlas, texture, true);
+            const ImVector<ImFontGlyph> base_glyphs = atlas.Fonts[0]->Glyphs;
+            const int base_width = atlas.TexWidth, base_height = atlas.TexHeight;
+
+            double t0 = ImGui_ImplNull_GetTime();
+            AddAtlasAppendItems(&atlas, data);
+            bool appended = false;
+            if (append)
+                appended = atlas.BuildAppend();
+            else
+                atlas.Build();
+            uploaded = UploadAtlasTexture(&atlas, texture, !appended);
+            total += ImGui_ImplNull_GetTime() - t0;
+
+            // Appending must not move anything, and the back-end copy of the texture must be up to date
+            if (append)
+                identical &= appended && atlas.TexWidth == base_width && atlas.TexHeight == base_height && CompareVectors(atlas.Fonts[0]->Glyphs, base_glyphs);
+            identical &= memcmp(texture.Data, atlas.TexPixelsRGBA32, (size_t)texture.size_in_bytes()) == 0;
+            const ImFont* font = atlas.Fonts[1];
+            const ImFont* rebuilt_font = rebuilt.Fonts[1];
+            identical &= font->Glyphs.Size == rebuilt_font->Glyphs.Size;
+            for (int glyph_n = 0; glyph_n < font->Glyphs.Size && identical; glyph_n++)
+                identical &= CompareOnDemandGlyph(atlas, &font->Glyphs[glyph_n], rebuilt, rebuilt_font->FindGlyph((ImWchar)font->Glyphs[glyph_n].Codepoint), false);
+        }
+        printf("%-10s %9.3f %10d %10s\n", append ? "append" : "rebuild", total * 1000.0 / iterations, (int)(uploaded / 1024), identical ? "identical" : "MISMATCH");
+        all_identical &= identical;
+    }
+    return all_identical;
+}
+
+// Menu font at every size of g_AtlasSdfSizes[], or once as a signed distance field
+static const float g_AtlasSdfSizes[] = { 13.0f, 16.0f, 24.0f, 48.0f, 96.0f };
+static const float g_AtlasSdfFontSize = 32.0f;
+static const double g_AtlasSdfMaxMeanError = 30.0;  // Limits on the error of SDF text vs baked text, in percent (see CalcCoverageError())
+static const double g_AtlasSdfMaxError = 50.0;
+
+static void AddAtlasSdfFonts(ImFontAtlas* atlas, AtlasBuildFontData& data, bool sdf)
+{
+    ImFontConfig config;
+    config.FontDataOwnedByAtlas = false;
+    config.GlyphRanges = atlas->GetGlyphRangesCyrillic();
+    config.SignedDistanceField = sdf;
+    for (int n = 0; n < (sdf ? 1 : IM_ARRAYSIZE(g_AtlasSdfSizes)); n++)
+        atlas->AddFontFromMemoryTTF(data.MenuFont.Data, data.MenuFont.Size, sdf ? g_AtlasSdfFontSize : g_AtlasSdfSizes[n], &config);
+}
+
+struct AtlasSdfFrameData
+{
+    float   Size;
+    float   RowsY[3];
+};
+
+// One row of text at the same size from: the font baked at that size (reference), the SDF font, the 16 px baked font
+static void AtlasSdfFrame(int, void* user_data)
+{
+    const AtlasSdfFrameData* frame = (const AtlasSdfFrameData*)user_data;
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    int size_n = 0;
+    while (g_AtlasSdfSizes[size_n] != frame->Size)
+        size_n++;
+    ImFont* fonts[3] = { atlas->Fonts[size_n], atlas->Fonts[IM_ARRAYSIZE(g_AtlasSdfSizes)], atlas->Fonts[1] };
+    for (int n = 0; n < 3; n++)
+        ImGui::GetForegroundDrawList()->AddText(fonts[n], frame->Size, ImVec2(8.0f, frame->RowsY[n]), IM_COL32_WHITE, "Hamburgefonstiv 0123 Sdf");
+}
+
+// Sum of |row - reference row| over the sum of the reference row, in percent (red channel: white text over black)
+static double CalcCoverageError(const ImVector<ImU32>& framebuffer, int width, int y, int ref_y, int rows_height, double* out_coverage)
+{
+    double error = 0.0, reference = 0.0, coverage = 0.0;
+    for (int row = 0; row < rows_height; row++)
+        for (int x = 0; x < width; x++)
+        {
+            const int a = (int)((framebuffer[(y + row) * width + x] >> IM_COL32_R_SHIFT) & 0xFF);
+            const int b = (int)((framebuffer[(ref_y + row) * width + x] >> IM_COL32_R_SHIFT) & 0xFF);
+            error += (a > b) ? a - b : b - a;
+            reference += b;
+            coverage += a;
+        }
+    *out_coverage = coverage;
+    return (reference > 0.0) ? error * 100.0 / reference : 0.0;
+}
+
+// One signed distance field font vs the same font baked at every size: build time and texture size.
+// Then text drawn through imgui_impl_soft at every size from the SDF font and from the 16 px font scaled, compared with the font baked at that size.
+static bool RunAtlasSdfScenario(const BenchmarkOptions& opt, AtlasBuildFontData& data)
+{
+    const int iterations = (opt.Frames / 100 > 3) ? opt.Frames / 100 : 3;
+    printf("%-10s %9s %9s\n", "sdf", "avg_ms", "tex_kb");
+    for (int sdf = 0; sdf < 2; sdf++)
+    {
+        double total = 0.0;
+        int tex_size = 0;
+        for (int n = 0; n < iterations; n++)
+        {
+            ImFontAtlas atlas;
+            AddAtlasSdfFonts(&atlas, data, sdf != 0);
+            double t0 = ImGui_ImplNull_GetTime();
+            atlas.Build();
+            total += ImGui_ImplNull_GetTime() - t0;
+            tex_size = atlas.TexWidth * atlas.TexHeight;
+        }
+        char label[32];
+        if (sdf)
+            snprintf(label, IM_ARRAYSIZE(label), "sdf %dpx", (int)g_AtlasSdfFontSize);
+        else
+            snprintf(label, IM_ARRAYSIZE(label), "baked x%d", IM_ARRAYSIZE(g_AtlasSdfSizes));
+        printf("%-10s %9.3f %9d\n", label, total * 1000.0 / iterations, tex_size / 1024);
+    }
+
+    const int width = 1280, height = 480;
+    ImGui::CreateContext();
+    ImGui::GetIO().IniFilename = NULL;
+    AddAtlasSdfFonts(ImGui::GetIO().Fonts, data, false);
+    AddAtlasSdfFonts(ImGui::GetIO().Fonts, data, true);
+    ImGui_ImplNull_Init((float)width, (float)height);
+    ImGui_ImplSoft_Init(1);
+    ImVector<ImU32> framebuffer;
+    framebuffer.resize(width * height);
+    printf("%-10s %9s %9s\n", "text_px", "sdf_err%", "scaled%");
+    bool all_drawn = true;
+    double sdf_error_sum = 0.0, sdf_error_max = 0.0;
+    for (int size_n = 0; size_n < IM_ARRAYSIZE(g_AtlasSdfSizes); size_n++)
+    {
+        AtlasSdfFrameData frame;
+        frame.Size = g_AtlasSdfSizes[size_n];
+        for (int n = 0; n < 3; n++)
+            frame.RowsY[n] = 4.0f + n * ImFloor(frame.Size * 1.5f);
+        ImGui_ImplNull_RunFrames(1, AtlasSdfFrame, &frame);
+        memset(framebuffer.Data, 0, (size_t)framebuffer.size_in_bytes());
+        ImGui_ImplSoft_RenderDrawData(ImGui::GetDrawData(), framebuffer.Data, width, height, width);
+        const int rows_height = (int)ImFloor(frame.Size * 1.5f);
+        double sdf_coverage, scaled_coverage;
+        const double sdf_error = CalcCoverageError(framebuffer, width, (int)frame.RowsY[1], (int)frame.RowsY[0], rows_height, &sdf_coverage);
+        const double scaled_error = CalcCoverageError(framebuffer, width, (int)frame.RowsY[2], (int)frame.RowsY[0], rows_height, &scaled_coverage);
+        printf("%-10d %9.1f %9.1f\n", (int)frame.Size, sdf_error, scaled_error);
+        all_drawn &= (sdf_coverage > 0.0);
+        sdf_error_sum += sdf_error;
+        sdf_error_max = ImMax(sdf_error_max, sdf_error);
+    }
+    const double sdf_error_mean = sdf_error_sum / IM_ARRAYSIZE(g_AtlasSdfSizes);
+    const bool sdf_ok = all_drawn && sdf_error_mean <= g_AtlasSdfMaxMeanError && sdf_error_max <= g_AtlasSdfMaxError;
+    printf("sdf error: mean %.1f%% (limit %.0f%%), max %.1f%% (limit %.0f%%): %s\n", sdf_error_mean, g_AtlasSdfMaxMeanError, sdf_error_max, g_AtlasSdfMaxError, sdf_ok ? "OK" : "FAILED");
+    if (opt.DumpFilename)
+        WritePPM(opt.DumpFilename, framebuffer.Data, width, height);
+    ImGui_ImplSoft_Shutdown();
+    ImGui_ImplNull_Shutdown();
+    ImGui::DestroyContext();
+    return sdf_ok;
+}
+
+static bool RunAtlasSuite(const BenchmarkOptions& opt)
+{
+    AtlasBuildFontData data;
+    if (!LoadFileData("HurmeGeometricSans3-Regular.ttf", &data.MenuFont))
+    {
+        fprintf(stderr, "Could not open HurmeGeometricSans3-Regular.ttf, run from the repository root.\n");
+        return false;
+    }
+    if (opt.FontFilename && !LoadFileData(opt.FontFilename, &data.ExtraFont))
+    {
+        fprintf(stderr, "Could not open %s\n", opt.FontFilename);
+        return false;
+    }
+    int max_threads = opt.MaxThreads;
+    if (max_threads <= 0)
+        max_threads = (int)std::thread::hardware_concurrency();
+    if (max_threads <= 0)
+        max_threads = 1;
+
+    // Single-threaded reference
+    ImFontAtlas reference;
+    AddAtlasBuildFonts(&reference, data);
+    reference.Build();
+    int glyphs_count = 0;
+    for (int n = 0; n < reference.Fonts.Size; n++)
+        glyphs_count += reference.Fonts[n]->Glyphs.Size;
+    printf("\n[atlas] %d fonts, %d glyphs, %dx%d texture%s\n", reference.Fonts.Size, glyphs_count, reference.TexWidth, reference.TexHeight, data.ExtraFont.empty() ? "" : ", with --font merged");
+    printf("%-10s %7s %9s %9s %10s\n", "build", "threads", "avg_ms", "speedup", "output");
+
+    const int iterations = (opt.Frames / 100 > 3) ? opt.Frames / 100 : 3;
+    bool all_identical = true;
+    double base_ms = 0.0;
+    for (int threads = 0; threads <= max_threads; threads = (threads == 0) ? 1 : (threads < max_threads && threads * 2 > max_threads) ? max_threads : threads * 2)
+    {
+        // threads == 0: BuildParallelForFn left to NULL
+        double total = 0.0;
+        bool identical = true;
+        for (int n = 0; n < iterations; n++)
+        {
+            ImFontAtlas atlas;
+            if (threads > 0)
+            {
+                atlas.BuildParallelForFn = AtlasBuildParallelFor;
+                atlas.BuildParallelForUserData = &threads;
+            }
+            AddAtlasBuildFonts(&atlas, data);
+            double t0 = ImGui_ImplNull_GetTime();
+            atlas.Build();
+            total += ImGui_ImplNull_GetTime() - t0;
+
+            identical &= CompareAtlasOutput(atlas, reference);
+        }
+        const double avg_ms = total * 1000.0 / iterations;
+        if (threads == 0)
+            base_ms = avg_ms;
+        printf("%-10s %7d %9.3f %8.2fx %10s\n", threads == 0 ? "serial" : "parallel", threads == 0 ? 1 : threads, avg_ms, base_ms / avg_ms, identical ? "identical" : "MISMATCH");
+        all_identical &= identical;
+    }
+    all_identical &= RunAtlasOnDemandScenario(opt, data);
+    all_identical &= RunAtlasSdfScenario(opt, data);
+    all_identical &= RunAtlasAppendScenario(opt, data);
+    return RunAtlasCacheScenario(opt) && all_identical;
+}
+
+//-----------------------------------------------------------------------------
+// Suite: micro
+//-----------------------------------------------------------------------------
+
+// Shared state for the micro benchmarks. Everything is set up once, outside of the timed region.
+struct MicroBenchState
+{
+    ImFont*             Font = NULL;
+    ImDrawList*         DrawList = NULL;
+    ImDrawListSplitter  Splitter;
+    ImGuiStorage        Storage;
+    ImGuiStorage        StorageHashed;      // Same pairs, hashed
+    ImVector<ImGuiID>   StorageKeys;
+    ImVector<char>      Labels;             // 64 zero-terminated labels of 32 characters, like widget labels with a "##" suffix
+    ImVector<char>      Paragraph;          // ~4 KB of ASCII prose, for word wrapping
+    ImVector<char>      ParagraphUtf8;      // Same with one multi-byte word in every sentence
+    ImVector<char>      LogText;            // 64 lines like the log of imgui_demo.cpp
+    ImVector<char>      IniData;
+    ImVector<char>      FontData;           // Menu font file, so atlas builds don't measure file I/O
+    ImVector<ImVec2>    Polygon;            // 32 points in clockwise order, the size of a rounded frame
+    ImVector<ImVec2>    Plot;               // 1M points of a noisy sine wave, for plot-sized polylines
+    volatile ImU32      Sink = 0;           // Keep results alive
+};
+static MicroBenchState g_Micro;
+
+static const char g_MicroText[] = "Chest (Exquisite)  Offscreen  Magnetize Crystal Ore  Speed 5.000";
+
+static void MicroHashStr(int iterations)
+{
+    ImU32 h = 0;
+    for (int n = 0; n < iterations; n++)
+        h += ImHashStr(g_Micro.Labels.Data + (n & 63) * 33, 0, h);
+    g_Micro.Sink = h;
+}
+
+static void MicroHashData(int iterations)
+{
+    ImU32 h = 0;
+    for (int n = 0; n < iterations; n++)
+        h += ImHashData(g_Micro.Labels.Data + (n & 63) * 33, 32, h);
+    g_Micro.Sink = h;
+}
+
+static void MicroStorageGetIntIn(ImGuiStorage& storage, int iterations)
+{
+    int sum = 0;
+    const int keys_mask = g_Micro.StorageKeys.Size - 1;
+    for (int n = 0; n < iterations; n++)
+        sum += storage.GetInt(g_Micro.StorageKeys[(n * 7) & keys_mask], 0);
+    g_Micro.Sink = (ImU32)sum;
+}
+
+static void MicroStorageSetIntIn(ImGuiStorage& storage, int iterations)
+{
+    const int keys_mask = g_Micro.StorageKeys.Size - 1;
+    for (int n = 0; n < iterations; n++)
+        storage.SetInt(g_Micro.StorageKeys[(n * 7) & keys_mask], n);
+}
+
+static void MicroStorageGetInt(int iterations)          { MicroStorageGetIntIn(g_Micro.Storage, iterations); }
+static void MicroStorageSetInt(int iterations)          { MicroStorageSetIntIn(g_Micro.Storage, iterations); }
+static void MicroStorageGetIntHashed(int iterations)    { MicroStorageGetIntIn(g_Micro.StorageHashed, iterations); }
+static void MicroStorageSetIntHashed(int iterations)    { MicroStorageSetIntIn(g_Micro.StorageHashed, iterations); }
+
+static void MicroCalcTextSize(int iterations)
+{
+    float w = 0.0f;
+    for (int n = 0; n < iterations; n++)
+        w += g_Micro.Font->CalcTextSizeA(g_Micro.Font->FontSize, FLT_MAX, 0.0f, g_MicroText + (n & 7)).x;
+    g_Micro.Sink = (ImU32)w;
+}
+
+// ImGui::CalcTextSize() of a widget label: find the "##" then look up the size cache (always hits here, like labels submitted every frame)
+static void MicroCalcTextSizeLabel(int iterations)
+{
+    float w = 0.0f;
+    for (int n = 0; n < iterations; n++)
+        w += ImGui::CalcTextSize(g_Micro.Labels.Data + (n & 63) * 33, NULL, true).x;
+    g_Micro.Sink = (ImU32)w;
+}
+
+// Same without the size cache: find the "##" then measure
+static void MicroCalcTextSizeLabelUncached(int iterations)
+{
+    ImGuiContext& g = *GImGui;
+    g.TextSizeCache.Enabled = false;
+    MicroCalcTextSizeLabel(iterations);
+    g.TextSizeCache.Enabled = true;
+}
+
+static void MicroCalcTextSizeWrapped(int iterations)
+{
+    float h = 0.0f;
+    for (int n = 0; n < iterations; n++)
+        h += g_Micro.Font->CalcTextSizeA(g_Micro.Font->FontSize, FLT_MAX, 400.0f, g_Micro.Paragraph.Data + (n & 7), g_Micro.Paragraph.Data + g_Micro.Paragraph.Size - 1).y;
+    g_Micro.Sink = (ImU32)h;
+}
+
+static void MicroCalcTextSizeWrappedUtf8(int iterations)
+{
+    float h = 0.0f;
+    for (int n = 0; n < iterations; n++)
+        h += g_Micro.Font->CalcTextSizeA(g_Micro.Font->FontSize, FLT_MAX, 400.0f, g_Micro.ParagraphUtf8.Data, g_Micro.ParagraphUtf8.Data + g_Micro.ParagraphUtf8.Size - 1).y;
+    g_Micro.Sink = (ImU32)h;
+}
+
+static void MicroResetDrawList()
+{
+    g_Micro.DrawList->_ResetForNewFrame();
+    g_Micro.DrawList->PushClipRectFullScreen();
+    g_Micro.DrawList->PushTextureID(ImGui::GetIO().Fonts->TexID);
+}
+
+static void MicroRenderText(int iterations)
+{
+    const ImVec4 clip_rect(0.0f, 0.0f, 1920.0f, 1080.0f);
+    MicroResetDrawList();
+    for (int n = 0; n < iterations; n++)
+    {
+        if ((n & 255) == 0)
+            MicroResetDrawList();
+        g_Micro.Font->RenderText(g_Micro.DrawList, g_Micro.Font->FontSize, ImVec2(10.0f, (float)(n & 63) * 16.0f), IM_COL32_WHITE, clip_rect, g_MicroText, g_MicroText + IM_ARRAYSIZE(g_MicroText) - 1);
+    }
+}
+
+// A whole log window worth of text per operation (like the Log and TextUnformatted() examples of imgui_demo.cpp)
+static void MicroRenderTextLog(int iterations)
+{
+    const ImVec4 clip_rect(0.0f, 0.0f, 1920.0f, 1080.0f);
+    for (int n = 0; n < iterations; n++)
+    {
+        MicroResetDrawList();
+        g_Micro.Font->RenderText(g_Micro.DrawList, g_Micro.Font->FontSize, ImVec2(10.0f, 4.0f), IM_COL32_WHITE, clip_rect, g_Micro.LogText.Data, g_Micro.LogText.Data + g_Micro.LogText.Size - 1);
+    }
+}
+
+// Same in a frame too small for it, clipped on the CPU: the glyphs crossing the edges are cut
+static void MicroRenderTextLogFineClip(int iterations)
+{
+    const ImVec4 clip_rect(12.5f, 9.5f, 300.5f, 700.5f);
+    for (int n = 0; n < iterations; n++)
+    {
+        MicroResetDrawList();
+        g_Micro.Font->RenderText(g_Micro.DrawList, g_Micro.Font->FontSize, ImVec2(10.0f, 4.0f), IM_COL32_WHITE, clip_rect, g_Micro.LogText.Data, g_Micro.LogText.Data + g_Micro.LogText.Size - 1, 0.0f, true);
+    }
+}
+
+static void MicroAddPolyline(int iterations)
+{
+    MicroResetDrawList();
+    for (int n = 0; n < iterations; n++)
+    {
+        if ((n & 255) == 0)
+            MicroResetDrawList();
+        g_Micro.DrawList->AddPolyline(g_Micro.Polygon.Data, g_Micro.Polygon.Size, IM_COL32_WHITE, true, 1.5f);
+    }
+}
+
+static void MicroAddConvexPolyFilled(int iterations)
+{
+    MicroResetDrawList();
+    for (int n = 0; n < iterations; n++)
+    {
+        if ((n & 255) == 0)
+            MicroResetDrawList();
+        g_Micro.DrawList->AddConvexPolyFilled(g_Micro.Polygon.Data, g_Micro.Polygon.Size, IM_COL32_WHITE);
+    }
+}
+
+static void MicroPlotPolyline(int iterations, int points_count, float thickness)
+{
+    for (int n = 0; n < iterations; n++)
+    {
+        MicroResetDrawList();
+        g_Micro.DrawList->AddPolyline(g_Micro.Plot.Data, points_count, IM_COL32_WHITE, false, thickness);
+    }
+}
+
+static void MicroPolyline10k(int iterations)        { MicroPlotPolyline(iterations, 10000, 1.0f); }
+static void MicroPolyline100k(int iterations)       { MicroPlotPolyline(iterations, 100000, 1.0f); }
+static void MicroPolyline1M(int iterations)         { MicroPlotPolyline(iterations, 1000000, 1.0f); }
+static void MicroPolyline100kThick(int iterations)  { MicroPlotPolyline(iterations, 100000, 2.5f); }
+
+static void MicroConvexPolyFilled100k(int iterations)
+{
+    for (int n = 0; n < iterations; n++)
+    {
+        MicroResetDrawList();
+        g_Micro.DrawList->AddConvexPolyFilled(g_Micro.Plot.Data, 100000, IM_COL32_WHITE);
+    }
+}
+
+// Widget frames: rounded filled rectangles with FrameRounding = 3.0f, as in Menu.cpp
+static void MicroAddRectFilledRounded(int iterations)
+{
+    MicroResetDrawList();
+    for (int n = 0; n < iterations; n++)
+    {
+        if ((n & 255) == 0)
+            MicroResetDrawList();
+        const ImVec2 p_min(10.0f + (float)(n & 15) * 20.0f, 10.0f + (float)(n & 63) * 22.0f);
+        g_Micro.DrawList->AddRectFilled(p_min, ImVec2(p_min.x + 150.0f, p_min.y + 19.0f), IM_COL32_WHITE, 3.0f);
+    }
+}
+
+static void MicroAddCircleFilled(int iterations)
+{
+    MicroResetDrawList();
+    for (int n = 0; n < iterations; n++)
+    {
+        if ((n & 255) == 0)
+            MicroResetDrawList();
+        g_Micro.DrawList->AddCircleFilled(ImVec2(100.0f + (float)(n & 15) * 20.0f, 100.0f), 7.0f, IM_COL32_WHITE, 16);
+    }
+}
+
+static void MicroAddCircle(int iterations)
+{
+    MicroResetDrawList();
+    for (int n = 0; n < iterations; n++)
+    {
+        if ((n & 255) == 0)
+            MicroResetDrawList();
+        g_Micro.DrawList->AddCircle(ImVec2(100.0f + (float)(n & 15) * 20.0f, 100.0f), 7.0f, IM_COL32_WHITE, 16, 1.0f);
+    }
+}
+
+// Columns/tables style usage: 4 channels with a background and a few items each, merged back
+static void MicroSplitterMerge(int iterations)
+{
+    ImDrawList* draw_list = g_Micro.DrawList;
+    for (int n = 0; n < iterations; n++)
+    {
+        MicroResetDrawList();
+        g_Micro.Splitter.Split(draw_list, 4);
+        for (int channel = 3; channel >= 0; channel--)
+        {
+            g_Micro.Splitter.SetCurrentChannel(draw_list, channel);
+            const float x = channel * 100.0f;
+            draw_list->PushClipRect(ImVec2(x, 0.0f), ImVec2(x + 100.0f, 400.0f));
+            for (int item = 0; item < 4; item++)
+                draw_list->AddRectFilled(ImVec2(x + 4.0f, item * 20.0f), ImVec2(x + 96.0f, item * 20.0f + 16.0f), IM_COL32(item * 60, 0, 0, 255));
+            draw_list->PopClipRect();
+        }
+        g_Micro.Splitter.Merge(draw_list);
+    }
+}
+
+static void MicroFontAtlasBuild(int iterations)
+{
+    for (int n = 0; n < iterations; n++)
+    {
+        ImFontAtlas atlas;
+        ImFontConfig config;
+        config.FontDataOwnedByAtlas = false;
+        config.GlyphRanges = atlas.GetGlyphRangesCyrillic();
+        config.RasterizerMultiply = 1.125f;
+        atlas.AddFontFromMemoryTTF(g_Micro.FontData.Data, g_Micro.FontData.Size, 16.0f, &config);
+        atlas.Build();
+        g_Micro.Sink = (ImU32)atlas.TexWidth;
+    }
+}
+
+static void MicroLoadIniSettings(int iterations)
+{
+    for (int n = 0; n < iterations; n++)
+        ImGui::LoadIniSettingsFromMemory(g_Micro.IniData.Data, (size_t)g_Micro.IniData.Size);
+}
+
+// Menu-style window with dozens of Checkbox/BeginChild calls
+static void MicroStressFrame(int, void*)
+{
+    ImGui::SetNextWindowPos(ImVec2(20.0f, 20.0f), ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImVec2(1200.0f, 900.0f), ImGuiCond_Always);
+    ImGui::Begin("Stress", NULL, ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_NoResize);
+    static bool values[8][12] = {};
+    for (int child_n = 0; child_n < 8; child_n++)
+    {
+        if (child_n & 1)
+            ImGui::SameLine();
+        ImGui::PushID(child_n);
+        ImGui::BeginChild("child", ImVec2(580.0f, 200.0f), true);
+        for (int n = 0; n < 12; n++)
+        {
+            char label[32];
+            sprintf(label, "Option %d##%d", n, n);
+            ImGui::Checkbox(label, &values[child_n][n]);
+        }
+        ImGui::EndChild();
+        ImGui::PopID();
+    }
+    ImGui::End();
+}
+
+// Checkbox labels of the menu's Visuals tab, as string literals and hashed at compile time (IM_LABEL)
+#define MICRO_MENU_LABELS(X) \
+    X("Chest (Common)") X("Chest (Exquisite)") X("Chest (Luxorius)") X("Wind Slime") X("Ice Bulk") X("Search Point") \
+    X("Offscreen##1") X("Offscreen##2") X("Offscreen##3") X("Offscreen##4") X("Seelie") X("Challenge") \
+    X("Ore (Metal)") X("Ore (Crystal)") X("Ore (Starsilver)") X("Offscreen##12") X("Offscreen##13") X("Archon Towers") \
+    X("Teleports") X("Calla Lily") X("Small Lamp Grass") X("Windwhell Aster") X("Offscreen##26") X("Silk flower")
+#define MICRO_MENU_LABEL_STR(_LITERAL)      _LITERAL,
+#define MICRO_MENU_LABEL_HASHED(_LITERAL)   IM_LABEL(_LITERAL),
+static const char* const g_MicroMenuLabels[] = { MICRO_MENU_LABELS(MICRO_MENU_LABEL_STR) };
+static const ImGuiLabel g_MicroMenuLabelsHashed[] = { MICRO_MENU_LABELS(MICRO_MENU_LABEL_HASHED) };
+static const int g_MicroMenuChildren = 4;
+
+// IDs of the checkboxes of one frame of MicroMenuLabelsFrame(): the labels hashed at run time vs combined with the ID stack
+static void MicroMenuLabelsGetID(int iterations)
+{
+    ImGuiID h = 0;
+    for (int n = 0; n < iterations; n++)
+        for (int child_n = 0; child_n < g_MicroMenuChildren; child_n++)
+            for (int label_n = 0; label_n < IM_ARRAYSIZE(g_MicroMenuLabels); label_n++)
+                h += ImHashStr(g_MicroMenuLabels[label_n], 0, g_Micro.StorageKeys[child_n] + n);
+    g_Micro.Sink = h;
+}
+
+static void MicroMenuLabelsGetIDHashed(int iterations)
+{
+    ImGuiID h = 0;
+    for (int n = 0; n < iterations; n++)
+        for (int child_n = 0; child_n < g_MicroMenuChildren; child_n++)
+            for (int label_n = 0; label_n < IM_ARRAYSIZE(g_MicroMenuLabelsHashed); label_n++)
+                h += ImHashLabel(g_MicroMenuLabelsHashed[label_n], g_Micro.StorageKeys[child_n] + n);
+    g_Micro.Sink = h;
+}
+
+// Children full of checkboxes with string literal labels, like the menu
+static void MicroMenuLabelsFrame(int, void* user_data)
+{
+    const bool hashed = (user_data != NULL);
+    ImGui::SetNextWindowPos(ImVec2(20.0f, 20.0f), ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImVec2(1200.0f, 1000.0f), ImGuiCond_Always);
+    ImGui::Begin("Labels", NULL, ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_NoResize);
+    static bool values[g_MicroMenuChildren][IM_ARRAYSIZE(g_MicroMenuLabels)] = {};
+    for (int child_n = 0; child_n < g_MicroMenuChildren; child_n++)
+    {
+        if (child_n & 1)
+            ImGui::SameLine();
+        ImGui::PushID(child_n);
+        ImGui::BeginChild("child", ImVec2(580.0f, 480.0f), true);
+        for (int label_n = 0; label_n < IM_ARRAYSIZE(g_MicroMenuLabels); label_n++)
+        {
+            if (hashed)
+                ImGui::Checkbox(g_MicroMenuLabelsHashed[label_n], &values[child_n][label_n]);
+            else
+                ImGui::Checkbox(g_MicroMenuLabels[label_n], &values[child_n][label_n]);
+        }
+        ImGui::EndChild();
+        ImGui::PopID();
+    }
+    ImGui::End();
+}
+
+static void MicroMenuLabelsFrames(int iterations)
+{
+    ImGui_ImplNull_RunFrames(iterations, MicroMenuLabelsFrame, NULL);
+}
+
+static void MicroMenuLabelsFramesHashed(int iterations)
+{
+    ImGui_ImplNull_RunFrames(iterations, MicroMenuLabelsFrame, (void*)&g_MicroMenuLabelsHashed);
+}
+
+static void MicroMenuFrame(int iterations)
+{
+    ImGui_ImplNull_RunFrames(iterations, MenuFrame, NULL);
+}
+
+static void MicroStressFrames(int iterations)
+{
+    ImGui_ImplNull_RunFrames(iterations, MicroStressFrame, NULL);
+}
+
+static bool SetupMicroBench()
+{
+    if (!CreateBenchmarkContext(1920, 1080))
+        return false;
+    ImGui_ImplNull_RunFrames(2, NULL, NULL);     // Initialize draw list shared data
+    MicroBenchState& s = g_Micro;
+    s.Font = ImGui::GetIO().Fonts->Fonts[0];
+    s.DrawList = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+
+    s.Labels.resize(64 * 33);
+    for (int n = 0; n < 64; n++)
+        snprintf(s.Labels.Data + n * 33, 33, "Checkbox label number %02d##%06d", n, n * 7919);
+    ImGuiTextBuffer paragraph, paragraph_utf8;
+    for (int n = 0; paragraph.size() < 4096; n++)
+    {
+        paragraph.appendf("Sentence %d: the tropical fish swims around the reef, looking for food; it found %d shrimps! ", n, n * 3);
+        paragraph_utf8.appendf("Sentence %d: the tropical fish (\xD1\x80\xD1\x8B\xD0\xB1\xD0\xB0) swims around the reef, looking for food; it found %d shrimps! ", n, n * 3);
+    }
+    s.Paragraph.resize(paragraph.size() + 1);
+    memcpy(s.Paragraph.Data, paragraph.c_str(), (size_t)s.Paragraph.Size);
+    s.ParagraphUtf8.resize(paragraph_utf8.size() + 1);
+    memcpy(s.ParagraphUtf8.Data, paragraph_utf8.c_str(), (size_t)s.ParagraphUtf8.Size);
+    ImGuiTextBuffer log;
+    const char* log_categories[] = { "info", "warn", "error" };
+    const char* log_words[] = { "Bumfuzzled", "Cattywampus", "Snickersnee", "Abibliophobia", "Absquatulate", "Nincompoop", "Pauciloquent" };
+    for (int n = 0; n < 64; n++)
+        log.appendf("[%05d] [%s] Hello, current time is %.1f, here's a word: '%s'\n", n * 13, log_categories[n % 3], n * 0.37f, log_words[n % 7]);
+    s.LogText.resize(log.size() + 1);
+    memcpy(s.LogText.Data, log.c_str(), (size_t)s.LogText.Size);
+    for (int n = 0; n < 1024; n++)
+        s.StorageKeys.push_back(ImHashData(&n, sizeof(n)));
+    s.Storage.SetHashed(false);
+    s.StorageHashed.SetHashed(true);
+    for (int n = 0; n < s.StorageKeys.Size; n++)
+    {
+        s.Storage.SetInt(s.StorageKeys[n], n);
+        s.StorageHashed.SetInt(s.StorageKeys[n], n);
+    }
+
+    ImGuiTextBuffer ini;
+    for (int n = 0; n < 50; n++)
+        ini.appendf("[Window][Window %d]\nPos=%d,%d\nSize=400,300\nCollapsed=0\n\n", n, n * 10, n * 5);
+    s.IniData.resize(ini.size());
+    memcpy(s.IniData.Data, ini.c_str(), (size_t)ini.size());
+
+    if (FILE* f = fopen("HurmeGeometricSans3-Regular.ttf", "rb"))
+    {
+        fseek(f, 0, SEEK_END);
+        s.FontData.resize((int)ftell(f));
+        fseek(f, 0, SEEK_SET);
+        if (fread(s.FontData.Data, 1, (size_t)s.FontData.Size, f) != (size_t)s.FontData.Size)
+            s.FontData.clear();
+        fclose(f);
+    }
+
+    for (int n = 0; n < 32; n++)
+    {
+        const float a = (float)n / 32.0f * 2.0f * IM_PI;
+        s.Polygon.push_back(ImVec2(200.0f + cosf(a) * 80.0f, 200.0f + sinf(a) * 12.0f));
+    }
+    s.Plot.resize(1000000);
+    for (int n = 0; n < s.Plot.Size; n++)
+        s.Plot[n] = ImVec2(n * 0.002f, 500.0f + sinf(n * 0.01f) * 300.0f + (float)(n % 13));
+    return !s.FontData.empty();
+}
+
+static void ShutdownMicroBench()
+{
+    MicroBenchState& s = g_Micro;
+    if (s.DrawList)
+        IM_DELETE(s.DrawList);
+    s.DrawList = NULL;
+    s.Font = NULL;
+    s.Splitter.ClearFreeMemory();
+    s.Storage.Clear();
+    s.StorageHashed.Clear();
+    s.StorageKeys.clear();
+    s.Labels.clear();
+    s.Paragraph.clear();
+    s.ParagraphUtf8.clear();
+    s.LogText.clear();
+    s.IniData.clear();
+    s.FontData.clear();
+    s.Polygon.clear();
+    s.Plot.clear();
+    DestroyBenchmarkContext();
+}
+
+struct MicroBenchResult
+{
+    const char* Name;
+    double      NsPerOp;
+    int         Iterations;
+    double      BaselineNsPerOp;    // 0.0 if not in the baseline
+};
+
+// Read the results of a previous '--json' run. This only understands the format written by WriteMicroBenchJson().
+static bool ReadMicroBenchBaseline(const char* filename, ImVector<MicroBenchResult>& results)
+{
+    FILE* f = fopen(filename, "rb");
+    if (f == NULL)
+        return false;
+    char line[256];
+    char name[128] = "";
+    while (fgets(line, sizeof(line), f))
+    {
+        double ns_per_op;
+        if (sscanf(line, " { \"name\": \"%127[^\"]\", \"ns_per_op\": %lf", name, &ns_per_op) != 2)
+            continue;
+        for (int n = 0; n < results.Size; n++)
+            if (strcmp(results[n].Name, name) == 0)
+                results[n].BaselineNsPerOp = ns_per_op;
+    }
+    fclose(f);
+    return true;
+}
+
+static bool WriteMicroBenchJson(const char* filename, const ImVector<MicroBenchResult>& results)
+{
+    FILE* f = fopen(filename, "wb");
+    if (f == NULL)
+        return false;
+    fprintf(f, "{\n  \"imgui_version\": \"%s\",\n  \"results\": [\n", ImGui::GetVersion());
+    for (int n = 0; n < results.Size; n++)
+        fprintf(f, "    { \"name\": \"%s\", \"ns_per_op\": %.3f, \"iterations\": %d }%s\n", results[n].Name, results[n].NsPerOp, results[n].Iterations, (n + 1 < results.Size) ? "," : "");
+    fprintf(f, "  ]\n}\n");
+    fclose(f);
+    return true;
+}
+
+static bool RunMicroSuite(const BenchmarkOptions& opt)
+{
+    struct { const char* Name; void (*Func)(int iterations); } cases[] =
+    {
+        { "ImHashStr",                                 MicroHashStr },
+        { "ImHashData",                                MicroHashData },
+        { "ImHashStr:menu_labels",                     MicroMenuLabelsGetID },
+        { "ImHashLabel:menu_labels",                   MicroMenuLabelsGetIDHashed },
+        { "ImGuiStorage::GetInt",                      MicroStorageGetInt },
+        { "ImGuiStorage::SetInt",                      MicroStorageSetInt },
+        { "ImGuiStorage::GetInt:hashed",               MicroStorageGetIntHashed },
+        { "ImGuiStorage::SetInt:hashed",               MicroStorageSetIntHashed },
+        { "ImFont::CalcTextSizeA",                     MicroCalcTextSize },
+        { "ImFont::CalcTextSizeA:wrapped4k",           MicroCalcTextSizeWrapped },
+        { "ImFont::CalcTextSizeA:wrapped4k:utf8",      MicroCalcTextSizeWrappedUtf8 },
+        { "ImGui::CalcTextSize:label",                 MicroCalcTextSizeLabel },
+        { "ImGui::CalcTextSize:label:uncached",        MicroCalcTextSizeLabelUncached },
+        { "ImFont::RenderText",                        MicroRenderText },
+        { "ImFont::RenderText:log",                    MicroRenderTextLog },
+        { "ImFont::RenderText:log:fineclip",           MicroRenderTextLogFineClip },
+        { "ImDrawList::AddPolyline",                   MicroAddPolyline },
+        { "ImDrawList::AddConvexPolyFilled",           MicroAddConvexPolyFilled },
+        { "ImDrawList::AddPolyline:10k",               MicroPolyline10k },
+        { "ImDrawList::AddPolyline:100k",              MicroPolyline100k },
+        { "ImDrawList::AddPolyline:1M",                MicroPolyline1M },
+        { "ImDrawList::AddPolyline:100k:thick",        MicroPolyline100kThick },
+        { "ImDrawList::AddConvexPolyFilled:100k",      MicroConvexPolyFilled100k },
+        { "ImDrawList::AddRectFilled:rounded",         MicroAddRectFilledRounded },
+        { "ImDrawList::AddCircleFilled",               MicroAddCircleFilled },
+        { "ImDrawList::AddCircle",                     MicroAddCircle },
+        { "ImDrawListSplitter::Merge",                 MicroSplitterMerge },
+        { "ImFontAtlas::Build",                        MicroFontAtlasBuild },
+        { "LoadIniSettingsFromMemory",                 MicroLoadIniSettings },
+        { "frame:menu",                                MicroMenuFrame },
+        { "frame:checkbox_children",                   MicroStressFrames },
+        { "frame:checkbox_labels",                     MicroMenuLabelsFrames },
+        { "frame:checkbox_labels:hashed",              MicroMenuLabelsFramesHashed },
+    };
+    printf("\n[micro] ns per operation, median of 5 samples of at least %.0f ms\n", opt.MicroSampleMs);
+    if (!SetupMicroBench())
+    {
+        fprintf(stderr, "Could not set up micro benchmarks, run from the repository root.\n");
+        ShutdownMicroBench();
+        return false;
+    }
+
+    ImVector<MicroBenchResult> results;
+    for (int case_n = 0; case_n < IM_ARRAYSIZE(cases); case_n++)
+    {
+        if (opt.Filter && strstr(cases[case_n].Name, opt.Filter) == NULL)
+            continue;
+
+        // Calibrate the iteration count to the sample duration, then keep the median sample
+        int iterations = 1;
+        for (;;)
+        {
+            double t0 = ImGui_ImplNull_GetTime();
+            cases[case_n].Func(iterations);
+            const double ms = (ImGui_ImplNull_GetTime() - t0) * 1000.0;
+            if (ms >= opt.MicroSampleMs || iterations >= (1 << 28))
+                break;
+            iterations *= (ms < opt.MicroSampleMs * 0.1) ? 10 : 2;
+        }
+        double samples[5];
+        for (int sample_n = 0; sample_n < IM_ARRAYSIZE(samples); sample_n++)
+        {
+            double t0 = ImGui_ImplNull_GetTime();
+            cases[case_n].Func(iterations);
+            samples[sample_n] = (ImGui_ImplNull_GetTime() - t0) * 1e9 / iterations;
+        }
+        qsort(samples, IM_ARRAYSIZE(samples), sizeof(double), CompareDouble);
+        MicroBenchResult result = { cases[case_n].Name, samples[IM_ARRAYSIZE(samples) / 2], iterations, 0.0 };
+        results.push_back(result);
+    }
+    ShutdownMicroBench();
+
+    if (opt.BaselineFilename && !ReadMicroBenchBaseline(opt.BaselineFilename, results))
+        fprintf(stderr, "Could not read baseline %s\n", opt.BaselineFilename);
+
+    int regressions = 0;
+    printf("%-40s %12s %12s %12s %8s\n", "case", "iterations", "ns_per_op", "baseline", "delta");
+    for (int n = 0; n < results.Size; n++)
+    {
+        const MicroBenchResult& r = results[n];
+        if (r.BaselineNsPerOp <= 0.0)
+        {
+            printf("%-40s %12d %12.2f %12s %8s\n", r.Name, r.Iterations, r.NsPerOp, "-", "-");
+            continue;
+        }
+        const double delta = (r.NsPerOp / r.BaselineNsPerOp - 1.0) * 100.0;
+        const bool regressed = delta > opt.Threshold;
+        regressions += regressed ? 1 : 0;
+        printf("%-40s %12d %12.2f %12.2f %+7.1f%%%s\n", r.Name, r.Iterations, r.NsPerOp, r.BaselineNsPerOp, delta, regressed ? "  REGRESSION" : "");
+    }
+    if (opt.BaselineFilename)
+        printf("%d regression(s) beyond %.1f%%\n", regressions, opt.Threshold);
+    if (opt.JsonFilename && !WriteMicroBenchJson(opt.JsonFilename, results))
+    {
+        fprintf(stderr, "Could not write %s\n", opt.JsonFilename);
+        return false;
+    }
+    return regressions == 0;
+}
+
+//-----------------------------------------------------------------------------
+// Suite: hash
+//-----------------------------------------------------------------------------
+
+#if defined(IMGUI_USE_HASH_CRC32C)
+static const char g_HashName[] = "CRC32C (IMGUI_USE_HASH_CRC32C)";
+#elif defined(IMGUI_USE_HASH_WYHASH)
+static const char g_HashName[] = "wyhash (IMGUI_USE_HASH_WYHASH)";
+#else
+static const char g_HashName[] = "CRC32 (default)";
+#endif
+
+static volatile ImU32 g_HashSink;
+
+// Keys of the hash suite, all set up before timing
+struct HashSuiteData
+{
+    ImVector<char>          LiteralsBuf;
+    ImVector<const char*>   Literals;       // String literals of MenuUI.cpp and imgui_demo.cpp, unique by hashed part
+    int                     NestedCount;    // Literals used as parent and child for the nested IDs
+    ImVector<char>          GeneratedBuf;
+    ImVector<const char*>   Generated;      // "Object %d##%d" labels, as in a list of items
+    ImU32                   Seed;           // ID of the parent for the generated labels and PushID() keys
+};
+
+// Part of a label hashed by ImHashStr(): from its last "###", else all of it
+static const char* HashedLabelPart(const char* label)
+{
+    const char* hashed = label;
+    for (const char* p = label; *p; p++)
+        if (p[0] == '#' && p[1] == '#' && p[2] == '#')
+            hashed = p;
+    return hashed;
+}
+
+static int CompareHashedLabelPart(const void* lhs, const void* rhs)
+{
+    return strcmp(HashedLabelPart(*(const char* const*)lhs), HashedLabelPart(*(const char* const*)rhs));
+}
+
+static int CompareU32(const void* lhs, const void* rhs)
+{
+    ImU32 a = *(const ImU32*)lhs, b = *(const ImU32*)rhs;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+static void AppendString(ImVector<char>* buf, const char* str, const char* str_end)
+{
+    const int offset = buf->Size;
+    buf->resize(offset + (int)(str_end - str) + 1);
+    memcpy(buf->Data + offset, str, (size_t)(str_end - str));
+    buf->back() = 0;
+}
+
+// Append the string literals of a C++ source file (escape sequences kept as written) to 'out_buf', skipping comments and character literals
+static void CollectStringLiterals(const ImVector<char>& src, ImVector<char>* out_buf)
+{
+    const char* p = src.begin();
+    const char* end = src.end();
+    while (p < end)
+    {
+        if (p[0] == '/' && p + 1 < end && p[1] == '/')
+        {
+            while (p < end && *p != '\n')
+                p++;
+        }
+        else if (p[0] == '/' && p + 1 < end && p[1] == '*')
+        {
+            for (p += 2; p + 1 < end && !(p[0] == '*' && p[1] == '/'); p++) {}
+            p += 2;
+        }
+        else if (p[0] == '"' || p[0] == '\'')
+        {
+            const char quote = *p++;
+            const char* literal = p;
+            while (p < end && *p != quote)
+                p += (*p == '\\' && p + 1 < end) ? 2 : 1;
+            if (quote == '"' && p > literal)
+            {
+                AppendString(out_buf, literal, p);
+            }
+            p++;
+        }
+        else
+        {
+            p++;
+        }
+    }
+}
+
+static bool SetupHashSuite(HashSuiteData& data)
+{
+    const char* filenames[] = { "MenuUI.cpp", "ImGui/imgui_demo.cpp" };
+    for (int n = 0; n < IM_ARRAYSIZE(filenames); n++)
+    {
+        ImVector<char> src;
+        if (!LoadFileData(filenames[n], &src))
+            return false;
+        CollectStringLiterals(src, &data.LiteralsBuf);
+    }
+    for (const char* p = data.LiteralsBuf.begin(); p < data.LiteralsBuf.end(); p += strlen(p) + 1)
+        data.Literals.push_back(p);
+
+    // Literals with the same hashed part are the same ID on purpose: keep one of them
+    qsort(data.Literals.Data, (size_t)data.Literals.Size, sizeof(const char*), CompareHashedLabelPart);
+    int unique_count = 0;
+    for (int n = 0; n < data.Literals.Size; n++)
+        if (unique_count == 0 || strcmp(HashedLabelPart(data.Literals[unique_count - 1]), HashedLabelPart(data.Literals[n])) != 0)
+            data.Literals[unique_count++] = data.Literals[n];
+    data.Literals.resize(unique_count);
+    data.NestedCount = ImMin(data.Literals.Size, 2048);
+
+    const int generated_count = 1000000;
+    char label[64];
+    for (int n = 0; n < generated_count; n++)
+    {
+        const int len = ImFormatString(label, IM_ARRAYSIZE(label), "Object %d##%d", n % 1000, n);
+        AppendString(&data.GeneratedBuf, label, label + len);
+    }
+    for (const char* p = data.GeneratedBuf.begin(); p < data.GeneratedBuf.end(); p += strlen(p) + 1)
+        data.Generated.push_back(p);
+    data.Seed = ImHashStr("Objects");
+    return true;
+}
+
+// Each corpus writes the ID of every key to 'out_ids'
+static void HashLiterals(const HashSuiteData& data, ImU32* out_ids)
+{
+    for (int n = 0; n < data.Literals.Size; n++)
+        out_ids[n] = ImHashStr(data.Literals[n]);
+}
+
+// Every literal pushed as an ID (e.g. a window or tree node) then every literal hashed with it as the seed
+static void HashNestedLiterals(const HashSuiteData& data, ImU32* out_ids)
+{
+    for (int parent_n = 0; parent_n < data.NestedCount; parent_n++)
+    {
+        const ImU32 seed = ImHashStr(data.Literals[parent_n]);
+        for (int child_n = 0; child_n < data.NestedCount; child_n++)
+            *out_ids++ = ImHashStr(data.Literals[child_n], 0, seed);
+    }
+}
+
+static void HashGenerated(const HashSuiteData& data, ImU32* out_ids)
+{
+    for (int n = 0; n < data.Generated.Size; n++)
+        out_ids[n] = ImHashStr(data.Generated[n], 0, data.Seed);
+}
+
+// PushID(int) in a loop
+static void HashPushIdInt(const HashSuiteData& data, ImU32* out_ids)
+{
+    for (int n = 0; n < data.Generated.Size; n++)
+        out_ids[n] = ImHashData(&n, sizeof(n), data.Seed);
+}
+
+// PushID(const void*) with the addresses of the generated labels
+static void HashPushIdPtr(const HashSuiteData& data, ImU32* out_ids)
+{
+    for (int n = 0; n < data.Generated.Size; n++)
+    {
+        const void* ptr = data.Generated[n];
+        out_ids[n] = ImHashData(&ptr, sizeof(ptr), data.Seed);
+    }
+}
+
+static double CalcAvgHashedLen(const ImVector<const char*>& labels, int count)
+{
+    size_t len = 0;
+    for (int n = 0; n < count; n++)
+        len += strlen(HashedLabelPart(labels[n]));
+    return (double)len / count;
+}
+
+// Speed of every corpus (best of 3 runs), and how many of its IDs collide vs what a perfectly random 32-bit hash would give.
+// Build with -DIMGUI_USE_HASH_WYHASH, or -DIMGUI_USE_HASH_CRC32C -msse4.2, to compare the hashes.
+static bool RunHashSuite(const BenchmarkOptions&)
+{
+    printf("\n[hash] %s\n", g_HashName);
+    HashSuiteData data;
+    if (!SetupHashSuite(data))
+    {
+        fprintf(stderr, "Could not load the source files, run from the repository root.\n");
+        return false;
+    }
+    struct { const char* Name; int KeysCount; double AvgLen; void (*Func)(const HashSuiteData& data, ImU32* out_ids); } corpora[] =
+    {
+        { "literals",           data.Literals.Size,                     CalcAvgHashedLen(data.Literals, data.Literals.Size),    HashLiterals },
+        { "literals:nested",    data.NestedCount * data.NestedCount,    CalcAvgHashedLen(data.Literals, data.NestedCount),      HashNestedLiterals },
+        { "generated",          data.Generated.Size,                    CalcAvgHashedLen(data.Generated, data.Generated.Size),  HashGenerated },
+        { "push_id:int",        data.Generated.Size,                    (double)sizeof(int),                                    HashPushIdInt },
+        { "push_id:ptr",        data.Generated.Size,                    (double)sizeof(void*),                                  HashPushIdPtr },
+    };
+    printf("%-18s %9s %8s %11s %11s %9s\n", "corpus", "keys", "avg_len", "ns_per_key", "collisions", "expected");
+    ImVector<ImU32> ids;
+    for (int corpus_n = 0; corpus_n < IM_ARRAYSIZE(corpora); corpus_n++)
+    {
+        const int keys_count = corpora[corpus_n].KeysCount;
+        const int repeat_count = ImMax(1, 1000000 / keys_count);
+        ids.resize(keys_count);
+        double best_sec = 0.0;
+        for (int run_n = 0; run_n < 3; run_n++)
+        {
+            const double t0 = ImGui_ImplNull_GetTime();
+            for (int repeat_n = 0; repeat_n < repeat_count; repeat_n++)
+                corpora[corpus_n].Func(data, ids.Data);
+            const double sec = (ImGui_ImplNull_GetTime() - t0) / repeat_count;
+            best_sec = (run_n == 0 || sec < best_sec) ? sec : best_sec;
+        }
+
+        // Keys sharing an ID with the previous one once sorted
+        qsort(ids.Data, (size_t)ids.Size, sizeof(ImU32), CompareU32);
+        int collisions = 0;
+        for (int n = 1; n < ids.Size; n++)
+            collisions += (ids[n] == ids[n - 1]) ? 1 : 0;
+        const double expected = (double)keys_count * (keys_count - 1) / 2.0 / 4294967296.0;
+        printf("%-18s %9d %8.1f %11.2f %11d %9.1f\n", corpora[corpus_n].Name, keys_count, corpora[corpus_n].AvgLen, best_sec * 1e9 / keys_count, collisions, expected);
+    }
+
+    // Throughput of long keys
+    const int sizes[] = { 64, 256, 4096 };
+    ImVector<char> buf;
+    buf.resize(1 << 20);
+    for (int n = 0; n < buf.Size; n++)
+        buf[n] = (char)(n * 2654435761u >> 24);
+    for (int size_n = 0; size_n < IM_ARRAYSIZE(sizes); size_n++)
+    {
+        const int size = sizes[size_n];
+        double best_sec = 0.0;
+        ImU32 h = 0;
+        for (int run_n = 0; run_n < 3; run_n++)
+        {
+            const double t0 = ImGui_ImplNull_GetTime();
+            for (int rep = 0; rep < 64; rep++)
+                for (int offset = 0; offset + size <= buf.Size; offset += size)
+                    h = ImHashData(buf.Data + offset, (size_t)size, h);
+            const double sec = ImGui_ImplNull_GetTime() - t0;
+            best_sec = (run_n == 0 || sec < best_sec) ? sec : best_sec;
+        }
+        g_HashSink = h;
+        printf("ImHashData %4d bytes: %6.2f GB/s\n", size, 64.0 * (buf.Size / size) * size / best_sec * 1e-9);
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Suite: storage
+//-----------------------------------------------------------------------------
+
+static volatile int g_StorageSink;
+
+// Time of 'func' in ns per item, best of 3 runs. 'setup' runs before each of them, untimed.
+template<typename SETUP, typename FUNC>
+static double TimeStorageOp(int items_count, SETUP setup, FUNC func)
+{
+    double best_sec = 0.0;
+    for (int run_n = 0; run_n < 3; run_n++)
+    {
+        setup();
+        const double t0 = ImGui_ImplNull_GetTime();
+        func();
+        const double sec = ImGui_ImplNull_GetTime() - t0;
+        best_sec = (run_n == 0 || sec < best_sec) ? sec : best_sec;
+    }
+    return best_sec * 1e9 / items_count;
+}
+
+// Sorted vs hashed ImGuiStorage from 10 to 1M pairs, with IDs as keys (as tree node states in a window StateStorage).
+// insert: SetInt() of new keys in random order. bulk: Data.push_back() then BuildSortByKey(). hit/miss: GetInt() of random present/absent keys.
+// Sorted insertions are O(N) each: they are skipped (-) above 100K pairs.
+static bool RunStorageSuite(const BenchmarkOptions&)
+{
+    printf("\n[storage] ns per pair or query, sorted vs hashed ImGuiStorage\n");
+    printf("%8s %-7s %9s %9s %9s %9s %11s\n", "pairs", "mode", "insert", "bulk", "get_hit", "get_miss", "bytes/pair");
+    const int lookups_count = 1000000;
+    ImVector<ImGuiID> keys, lookup_keys, miss_keys;
+    for (int keys_count = 10; keys_count <= 1000000; keys_count *= 10)
+    {
+        keys.resize(keys_count);
+        for (int n = 0; n < keys_count; n++)
+            keys[n] = ImHashData(&n, sizeof(n), 0x12345678);
+        lookup_keys.resize(lookups_count);
+        miss_keys.resize(lookups_count);
+        ImU32 rng = 1;
+        for (int n = 0; n < lookups_count; n++)
+        {
+            rng = rng * 1664525u + 1013904223u;
+            lookup_keys[n] = keys[(int)((ImU64)rng * (ImU32)keys_count >> 32)];
+            miss_keys[n] = ImHashData(&n, sizeof(n), 0x87654321);
+        }
+
+        for (int mode_n = 0; mode_n < 2; mode_n++)
+        {
+            const bool hashed = (mode_n == 1);
+            ImGuiStorage storage;
+            storage.SetHashed(hashed);
+            double insert_ns = -1.0;
+            if (hashed || keys_count <= 100000)
+                insert_ns = TimeStorageOp(keys_count, [&]() { storage.Clear(); }, [&]() { for (int n = 0; n < keys_count; n++) storage.SetInt(keys[n], n); });
+            const double bulk_ns = TimeStorageOp(keys_count, [&]() { storage.Clear(); }, [&]()
+            {
+                for (int n = 0; n < keys_count; n++)
+                    storage.Data.push_back(ImGuiStorage::ImGuiStoragePair(keys[n], n));
+                storage.BuildSortByKey();
+            });
+            int sum = 0;
+            const double hit_ns = TimeStorageOp(lookups_count, []() {}, [&]() { for (int n = 0; n < lookups_count; n++) sum += storage.GetInt(lookup_keys[n], -1); });
+            const double miss_ns = TimeStorageOp(lookups_count, []() {}, [&]() { for (int n = 0; n < lookups_count; n++) sum += storage.GetInt(miss_keys[n], 0); });
+            g_StorageSink = sum;
+            char insert_buf[16];
+            if (insert_ns >= 0.0)
+                ImFormatString(insert_buf, IM_ARRAYSIZE(insert_buf), "%.1f", insert_ns);
+            else
+                ImFormatString(insert_buf, IM_ARRAYSIZE(insert_buf), "-");
+            const double bytes_per_pair = (double)(storage.Data.size_in_bytes() + storage.HashSlots.size_in_bytes()) / keys_count;
+            printf("%8d %-7s %9s %9.1f %9.1f %9.1f %11.1f\n", keys_count, hashed ? "hashed" : "sorted", insert_buf, bulk_ns, hit_ns, miss_ns, bytes_per_pair);
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    BenchmarkOptions opt;
+    for (int n = 1; n < argc; n++)
+    {
+        if (strcmp(argv[n], "--frames") == 0 && n + 1 < argc)
+            opt.Frames = atoi(argv[++n]);
+        else if (strcmp(argv[n], "--size") == 0 && n + 1 < argc)
+            sscanf(argv[++n], "%dx%d", &opt.Width, &opt.Height);
+        else if (strcmp(argv[n], "--threads") == 0 && n + 1 < argc)
+            opt.MaxThreads = atoi(argv[++n]);
+        else if (strcmp(argv[n], "--dump") == 0 && n + 1 < argc)
+            opt.DumpFilename = argv[++n];
+        else if (strcmp(argv[n], "--capture") == 0 && n + 1 < argc)
+            opt.CaptureFilename = argv[++n];
+        else if (strcmp(argv[n], "--inputs") == 0 && n + 1 < argc)
+            opt.InputsFilename = argv[++n];
+        else if (strcmp(argv[n], "--font") == 0 && n + 1 < argc)
+            opt.FontFilename = argv[++n];
+        else if (strcmp(argv[n], "--json") == 0 && n + 1 < argc)
+            opt.JsonFilename = argv[++n];
+        else if (strcmp(argv[n], "--baseline") == 0 && n + 1 < argc)
+            opt.BaselineFilename = argv[++n];
+        else if (strcmp(argv[n], "--threshold") == 0 && n + 1 < argc)
+            opt.Threshold = atof(argv[++n]);
+        else if (strcmp(argv[n], "--filter") == 0 && n + 1 < argc)
+            opt.Filter = argv[++n];
+        else if (strcmp(argv[n], "--sample-ms") == 0 && n + 1 < argc)
+            opt.MicroSampleMs = atof(argv[++n]);
+        else if (argv[n][0] != '-' && opt.Suite == NULL)
+            opt.Suite = argv[n];
+        else
+        {
+            fprintf(stderr, "Usage: %s [frames|soft|replay|input|idle|atlas|micro|hash|storage] [--frames N] [--size WxH] [--threads N] [--dump file.ppm] [--capture file.imdc] [--inputs file.imir] [--font file.ttf] [--json out.json] [--baseline base.json] [--threshold percent] [--filter name] [--sample-ms ms]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (opt.Frames <= 0 || opt.Width < 0 || opt.Height < 0 || opt.MicroSampleMs <= 0.0)
+        return 1;
+
+    IMGUI_CHECKVERSION();
+    ImGui::SetAllocatorFunctions(CountingMalloc, CountingFree);
+    printf("Dear ImGui %s\n", ImGui::GetVersion());
+    struct { const char* Name; bool (*Func)(const BenchmarkOptions&); } suites[] =
+    {
+        { "frames", RunFramesSuite },
+        { "soft",   RunSoftSuite },
+        { "replay", RunReplaySuite },
+        { "input",  RunInputSuite },
+        { "idle",   RunIdleSuite },
+        { "atlas",  RunAtlasSuite },
+        { "micro",  RunMicroSuite },
+        { "hash",   RunHashSuite },
+        { "storage", RunStorageSuite },
+    };
+    bool found = false;
+    for (int n = 0; n < IM_ARRAYSIZE(suites); n++)
+    {
+        if (opt.Suite && strcmp(opt.Suite, suites[n].Name) != 0)
+            continue;
+        found = true;
+        if (!suites[n].Func(opt))
+            return 1;
+    }
+    if (!found)
+    {
+        fprintf(stderr, "Unknown suite '%s'\n", opt.Suite);
+        return 1;
+    }
+    return 0;
+}
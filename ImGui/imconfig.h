@@ -41,6 +41,8 @@
 //#define IMGUI_DISABLE_DEFAULT_FORMAT_FUNCTIONS            // Don't implement ImFormatString/ImFormatStringV so you can implement them yourself (e.g. if you don't want to link with vsnprintf)
 //#define IMGUI_DISABLE_DEFAULT_MATH_FUNCTIONS              // Don't implement ImFabs/ImSqrt/ImPow/ImFmod/ImCos/ImSin/ImAcos/ImAtan2 so you can implement them yourself.
 //#define IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS              // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite so you can implement them yourself if you don't want to link with fopen/fclose/fread/fwrite. This will also disable the LogToTTY() function.
+//#define IMGUI_DISABLE_SSE                                 // Don't use SSE2 intrinsics (AddPolyline/AddConvexPolyFilled tessellation, text scanning, ImHashLabel), even when the compiler targets SSE2.
+//#define IMGUI_DISABLE_NEON                                // Don't use NEON intrinsics (AddPolyline/AddConvexPolyFilled tessellation), even when the compiler targets AArch64.
 //#define IMGUI_DISABLE_DEFAULT_ALLOCATORS                  // Don't implement default allocators calling malloc()/free() to avoid linking with them. You will need to call ImGui::SetAllocatorFunctions().
 
 //---- Include imgui_user.h at the end of imgui.h as a convenience
@@ -81,6 +83,23 @@
 // Read about ImGuiBackendFlags_RendererHasVtxOffset for details.
 //#define ImDrawIdx unsigned int
 
+//---- Use a compact 12-byte ImDrawVert (16-bit fixed point positions, 16-bit normalized uv) instead of the default 20-byte one, to reduce vertex upload bandwidth.
+// Positions are limited to -4096..+4095 with 1/8th pixel precision (see IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS) and uv to 0..1. Your renderer back-end needs to support it (see imgui_impl_dx11.cpp).
+// Building vertices costs more CPU time (float to fixed point conversions), and the SIMD tessellation paths of imgui_draw.cpp are disabled.
+//#define IMGUI_USE_COMPACT_DRAWVERT
+
+//---- Use another hash than the default table based CRC32 for IDs (ImHashStr/ImHashData). Both read 8 bytes per step instead of 1 and don't need the 1KB table.
+// - CRC32C uses the hardware instructions: requires SSE 4.2 on x86/x64 (e.g. -msse4.2, or /arch:AVX with MSVC) or the CRC extension on ARM (e.g. -march=armv8-a+crc).
+// - WYHASH is a portable multiply based hash, reading 16 bytes per step.
+// IDs are different from the default ones, so are the table IDs saved in .ini files: settings of tables saved with another hash are discarded.
+// Run the Benchmark 'hash' suite to compare speed and collisions.
+//#define IMGUI_USE_HASH_CRC32C
+//#define IMGUI_USE_HASH_WYHASH
+
+//---- Make every ImGuiStorage hashed (open addressing index) instead of sorted: O(1) queries and insertions instead of O(log N) queries and O(N) insertions,
+// for 8 more bytes per slot. Individual storages can be switched with ImGuiStorage::SetHashed(). Run the Benchmark 'storage' suite to compare.
+//#define IMGUI_USE_HASHED_STORAGE
+
 //---- Override ImDrawCallback signature (will need to modify renderer back-ends accordingly)
 //struct ImDrawList;
 //struct ImDrawCmd;
@@ -100,6 +119,10 @@
 //---- Debug Tools: Enable slower asserts
 //#define IMGUI_DEBUG_PARANOID
 
+//---- Debug Tools: Track allocations by subsystem (draw lists, storage, text buffers, font atlas, input text) and by window: live bytes, high-water marks
+// and allocations per frame, displayed in 'Metrics->Allocations' and in the window nodes. Adds a 16 bytes header to every allocation made through IM_ALLOC().
+//#define IMGUI_ENABLE_ALLOC_TRACKING
+
 //---- Tip: You can add extra functions within the ImGui:: namespace, here or in your own headers files.
 /*
 namespace ImGui
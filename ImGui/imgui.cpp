@@ -62,6 +62,7 @@ CODE
 // [SECTION] ImGuiStorage
 // [SECTION] ImGuiTextFilter
 // [SECTION] ImGuiTextBuffer
+// [SECTION] ImGuiFrameArena
 // [SECTION] ImGuiListClipper
 // [SECTION] STYLING
 // [SECTION] RENDER HELPERS
@@ -760,6 +761,26 @@ CODE
 #include <TargetConditionals.h>
 #endif
 
+// Use SSE2 to combine label hashes with the ID stack 4 bits at a time in ImHashLabel(), when available
+#if (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)) && !defined(IMGUI_DISABLE_SSE)
+#define IMGUI_HASH_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+// Hardware CRC32C for IMGUI_USE_HASH_CRC32C (see imconfig.h)
+#ifdef IMGUI_USE_HASH_CRC32C
+#if defined(__SSE4_2__) || defined(__AVX__)
+#include <nmmintrin.h>      // _mm_crc32_u8, _mm_crc32_u32, _mm_crc32_u64
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>       // __crc32cb, __crc32cw, __crc32cd
+#else
+#error IMGUI_USE_HASH_CRC32C needs SSE 4.2 (x86/x64) or the CRC extension (ARM) to be enabled in the compiler options
+#endif
+#endif
+#if defined(IMGUI_USE_HASH_WYHASH) && defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>         // _umul128
+#endif
+
 // Visual Studio warnings
 #ifdef _MSC_VER
 #pragma warning (disable: 4127)             // condition expression is constant
@@ -813,6 +834,9 @@ static const float WINDOWS_RESIZE_FROM_EDGES_HALF_THICKNESS = 4.0f;     // Exten
 static const float WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER = 0.04f;    // Reduce visual noise by only highlighting the border after a certain time.
 static const float WINDOWS_MOUSE_WHEEL_SCROLL_LOCK_TIMER    = 2.00f;    // Lock scrolled window (so it doesn't pick child windows that are scrolling through) for a certain time, unless mouse moved.
 
+// Waiting for events (GetEventWaitingTime())
+static const int   EVENT_WAITING_SETTLE_FRAMES              = 2;        // Frames rendered after inputs changed before letting the application wait, for hovering/layout to settle.
+
 //-------------------------------------------------------------------------
 // [SECTION] FORWARD DECLARATIONS
 //-------------------------------------------------------------------------
@@ -822,8 +846,8 @@ static void             FindHoveredWindow();
 static ImGuiWindow*     CreateNewWindow(const char* name, ImGuiWindowFlags flags);
 static ImVec2           CalcNextScrollFromScrollTargetAndClamp(ImGuiWindow* window);
 
-static void             AddDrawListToDrawData(ImVector<ImDrawList*>* out_list, ImDrawList* draw_list);
-static void             AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, ImGuiWindow* window);
+static void             AddDrawListToDrawData(ImFrameVector<ImDrawList*>* out_list, ImDrawList* draw_list);
+static void             AddWindowToSortBuffer(ImFrameVector<ImGuiWindow*>* out_sorted_windows, ImGuiWindow* window);
 
 static ImRect           GetViewportRect();
 
@@ -867,6 +891,8 @@ static void             UpdateSettings();
 static void             UpdateMouseInputs();
 static void             UpdateMouseWheel();
 static void             UpdateTabFocus();
+static void             UpdateEventWaitingInputs();
+static float            CalcEventWaitingTime();
 static void             UpdateDebugToolItemPicker();
 static bool             UpdateWindowManualResize(ImGuiWindow* window, const ImVec2& size_auto_fit, int* border_held, int resize_grip_count, ImU32 resize_grip_col[4], const ImRect& visibility_rect);
 static void             RenderWindowOuterBorders(ImGuiWindow* window);
@@ -912,6 +938,20 @@ static void*  (*GImAllocatorAllocFunc)(size_t size, void* user_data) = MallocWra
 static void   (*GImAllocatorFreeFunc)(void* ptr, void* user_data) = FreeWrapper;
 static void*    GImAllocatorUserData = NULL;
 
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+// Header prepended to every allocation, to account frees to the context, subsystem and window of the allocation.
+// Keeps the 16 bytes alignment of the underlying allocator.
+struct ImGuiAllocHeader
+{
+    ImU32           Size;
+    ImU32           ContextUid;         // 0: allocated without a current context
+    int             WindowIdx;          // Index in g.AllocWindows, -1: no current window
+    int             Tag;                // ImGuiAllocTag
+};
+IM_STATIC_ASSERT(sizeof(ImGuiAllocHeader) == 16);
+static ImU32    GImAllocContextUidCounter = 0;
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] USER FACING STRUCTURES (ImGuiStyle, ImGuiIO)
 //-----------------------------------------------------------------------------
@@ -1028,6 +1068,8 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
     ConfigWindowsMemoryCompactTimer = 60.0f;
+    ConfigRenderMergeDrawLists = false;
+    ConfigRenderGlyphInstances = false;
 
     // Platform Functions
     BackendPlatformName = BackendRendererName = NULL;
@@ -1399,6 +1441,8 @@ int ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args)
 }
 #endif // #ifdef IMGUI_DISABLE_DEFAULT_FORMAT_FUNCTIONS
 
+#if !defined(IMGUI_USE_HASH_CRC32C) && !defined(IMGUI_USE_HASH_WYHASH)
+
 // CRC32 needs a 1KB lookup table (not cache friendly)
 // Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
 // - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
@@ -1424,7 +1468,7 @@ static const ImU32 GCrc32LookupTable[256] =
 
 // Known size hash
 // It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
+// FIXME-OPT: CRC32 pretty much randomly access 1KB. See IMGUI_USE_HASH_CRC32C and IMGUI_USE_HASH_WYHASH in imconfig.h for table-less hashes.
 ImU32 ImHashData(const void* data_p, size_t data_size, ImU32 seed)
 {
     ImU32 crc = ~seed;
@@ -1440,7 +1484,7 @@ ImU32 ImHashData(const void* data_p, size_t data_size, ImU32 seed)
 // Because this syntax is rarely used we are optimizing for the common case.
 // - If we reach ### in the string we discard the hash so far and reset to the seed.
 // - We don't do 'current += 2; continue;' after handling ### to keep the code smaller/faster (measured ~10% diff in Debug build)
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
+// FIXME-OPT: CRC32 pretty much randomly access 1KB. See IMGUI_USE_HASH_CRC32C and IMGUI_USE_HASH_WYHASH in imconfig.h for table-less hashes.
 ImU32 ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
 {
     seed = ~seed;
@@ -1469,6 +1513,193 @@ ImU32 ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
     return ~crc;
 }
 
+#elif defined(IMGUI_USE_HASH_CRC32C)
+
+// Known size hash: CRC32C with the hardware instructions, 8 bytes per step on 64-bit targets
+// It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
+ImU32 ImHashData(const void* data_p, size_t data_size, ImU32 seed)
+{
+    const unsigned char* data = (const unsigned char*)data_p;
+#if defined(__SSE4_2__) || defined(__AVX__)
+    ImU32 crc = ~seed;
+#if defined(__x86_64__) || defined(_M_X64)
+    ImU64 crc64 = crc;
+    for (; data_size >= 8; data += 8, data_size -= 8)
+    {
+        ImU64 v;
+        memcpy(&v, data, 8);
+        crc64 = _mm_crc32_u64(crc64, v);
+    }
+    crc = (ImU32)crc64;
+#endif
+    for (; data_size >= 4; data += 4, data_size -= 4)
+    {
+        ImU32 v;
+        memcpy(&v, data, 4);
+        crc = _mm_crc32_u32(crc, v);
+    }
+    while (data_size-- != 0)
+        crc = _mm_crc32_u8(crc, *data++);
+#else
+    ImU32 crc = ~seed;
+    for (; data_size >= 8; data += 8, data_size -= 8)
+    {
+        ImU64 v;
+        memcpy(&v, data, 8);
+        crc = __crc32cd(crc, v);
+    }
+    while (data_size-- != 0)
+        crc = __crc32cb(crc, *data++);
+#endif
+    return ~crc;
+}
+
+#elif defined(IMGUI_USE_HASH_WYHASH)
+
+// wyhash v4 by Wang Yi (public domain), without the 48 bytes unrolled loop as we mostly hash short strings. Folded to 32 bits.
+static const ImU64 GWyhashSecret[4] = { 0xA0761D6478BD642FULL, 0xE7037ED1A0B428DBULL, 0x8EBC6AF09C88C6E3ULL, 0x589965CC75374CC3ULL };
+
+// 64x64->128 bits multiply: low half in *a, high half in *b
+static inline void ImWyMum(ImU64* a, ImU64* b)
+{
+#if defined(__SIZEOF_INT128__)
+    __uint128_t r = *a;
+    r *= *b;
+    *a = (ImU64)r;
+    *b = (ImU64)(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    *a = _umul128(*a, *b, b);
+#else
+    const ImU64 ha = *a >> 32, hb = *b >> 32, la = (ImU32)*a, lb = (ImU32)*b;
+    const ImU64 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    const ImU64 t = rl + (rm0 << 32);
+    const ImU64 lo = t + (rm1 << 32);
+    const ImU64 carry = (ImU64)(t < rl) + (ImU64)(lo < t);
+    *a = lo;
+    *b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+#endif
+}
+static inline ImU64 ImWyMix(ImU64 a, ImU64 b)                           { ImWyMum(&a, &b); return a ^ b; }
+static inline ImU64 ImWyRead8(const unsigned char* p)                   { ImU64 v; memcpy(&v, p, 8); return v; }
+static inline ImU64 ImWyRead4(const unsigned char* p)                   { ImU32 v; memcpy(&v, p, 4); return v; }
+static inline ImU64 ImWyRead3(const unsigned char* p, size_t size)      { return ((ImU64)p[0] << 16) | ((ImU64)p[size >> 1] << 8) | p[size - 1]; }
+
+// Known size hash: wyhash, 16 bytes per step
+// It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
+ImU32 ImHashData(const void* data_p, size_t data_size, ImU32 seed)
+{
+    const unsigned char* data = (const unsigned char*)data_p;
+    ImU64 s = seed ^ ImWyMix(seed ^ GWyhashSecret[0], GWyhashSecret[1]);
+    ImU64 a, b;
+    if (data_size <= 16)
+    {
+        if (data_size >= 4)
+        {
+            // Two overlapping pairs of 4 bytes reads cover 4..16 bytes
+            const size_t mid = (data_size >> 3) << 2;
+            a = (ImWyRead4(data) << 32) | ImWyRead4(data + mid);
+            b = (ImWyRead4(data + data_size - 4) << 32) | ImWyRead4(data + data_size - 4 - mid);
+        }
+        else
+        {
+            a = data_size > 0 ? ImWyRead3(data, data_size) : 0;
+            b = 0;
+        }
+    }
+    else
+    {
+        size_t remaining = data_size;
+        for (; remaining > 16; remaining -= 16, data += 16)
+            s = ImWyMix(ImWyRead8(data) ^ GWyhashSecret[1], ImWyRead8(data + 8) ^ s);
+        a = ImWyRead8(data + remaining - 16);
+        b = ImWyRead8(data + remaining - 8);
+    }
+    a ^= GWyhashSecret[1];
+    b ^= s;
+    ImWyMum(&a, &b);
+    const ImU64 h = ImWyMix(a ^ GWyhashSecret[0] ^ data_size, b ^ GWyhashSecret[1]);
+    return (ImU32)(h ^ (h >> 32));
+}
+#endif
+
+#if defined(IMGUI_USE_HASH_CRC32C) || defined(IMGUI_USE_HASH_WYHASH)
+// Zero-terminated string hash, with support for ### to reset back to seed value
+// We support a syntax of "label###id" where only "###id" is included in the hash, and only "label" gets displayed.
+// Same results as the byte per byte loop of the default hash: find the last "###" (memchr() skips to each '#') and hash from there in one ImHashData() call.
+ImU32 ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
+{
+    const char* data_end = data_p + (data_size != 0 ? data_size : strlen(data_p));
+    const char* hashed = data_p;
+    for (const char* p = data_p; (p = (const char*)memchr(p, '#', (size_t)(data_end - p))) != NULL; p++)
+        if (data_end - p >= 3 && p[1] == '#' && p[2] == '#')
+            hashed = p;
+    return ImHashData(hashed, (size_t)(data_end - hashed), seed);
+}
+#endif
+
+#ifdef IMGUI_HAS_CONSTEXPR_LABEL
+#if !defined(IMGUI_USE_HASH_CRC32C) && !defined(IMGUI_USE_HASH_WYHASH)
+// Registers of the CRC32 after 0 to 63 zero bytes, starting from each single bit set: Columns[n][bit] is the column of the linear map
+// "feed n zero bytes" for that bit. Computed by the compiler, so it is also a const table.
+struct ImCrc32ZeroBytesTable
+{
+    ImU32 Columns[64][32];
+    constexpr ImCrc32ZeroBytesTable() : Columns()
+    {
+        for (int bit = 0; bit < 32; bit++)
+            Columns[0][bit] = 1u << bit;
+        for (int n = 1; n < 64; n++)
+            for (int bit = 0; bit < 32; bit++)
+            {
+                ImU32 crc = Columns[n - 1][bit];
+                for (int k = 0; k < 8; k++)
+                    crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+                Columns[n][bit] = crc;
+            }
+    }
+};
+static constexpr ImCrc32ZeroBytesTable GCrc32ZeroBytesTable;
+
+// Hash of a label hashed at compile time, == ImHashStr(label.Label, 0, seed)
+// The CRC32 register is linear: hashing from register ~seed gives the CRC from a zero register (label.Crc), xor what ~seed
+// turns into after as many zero bytes. That costs 32 independent and+xor (8 with SSE2) instead of a dependent table lookup per character.
+// Labels with 64 or more hashed characters go through ImHashData().
+ImU32 ImHashLabel(const ImGuiLabel& label, ImU32 seed)
+{
+    if (label.HashedLen >= IM_ARRAYSIZE(GCrc32ZeroBytesTable.Columns))
+        return ImHashData(label.Label + label.HashedOffset, (size_t)label.HashedLen, seed);
+    const ImU32* columns = GCrc32ZeroBytesTable.Columns[label.HashedLen];
+    const ImU32 reg = ~seed;
+#ifdef IMGUI_HASH_USE_SSE2
+    // 4 columns at a time: lanes whose bit is set in 'reg' keep their column
+    const __m128i reg4 = _mm_set1_epi32((int)reg);
+    __m128i bits4 = _mm_setr_epi32(1, 2, 4, 8);
+    __m128i acc4 = _mm_setzero_si128();
+    for (int bit = 0; bit < 32; bit += 4, bits4 = _mm_slli_epi32(bits4, 4))
+    {
+        const __m128i mask4 = _mm_cmpeq_epi32(_mm_and_si128(reg4, bits4), bits4);
+        acc4 = _mm_xor_si128(acc4, _mm_and_si128(mask4, _mm_loadu_si128((const __m128i*)(const void*)(columns + bit))));
+    }
+    acc4 = _mm_xor_si128(acc4, _mm_shuffle_epi32(acc4, _MM_SHUFFLE(1, 0, 3, 2)));
+    acc4 = _mm_xor_si128(acc4, _mm_shuffle_epi32(acc4, _MM_SHUFFLE(2, 3, 0, 1)));
+    return ~(label.Crc ^ (ImU32)_mm_cvtsi128_si32(acc4));
+#else
+    ImU32 crc = label.Crc;
+    for (int bit = 0; bit < 32; bit++)
+        crc ^= columns[bit] & (0u - ((reg >> bit) & 1));
+    return ~crc;
+#endif
+}
+#else
+// Hash of a label hashed at compile time, == ImHashStr(label.Label, 0, seed)
+// The other hashes read 8 or 16 bytes per step: only the search for "###" and the string length are done at compile time.
+ImU32 ImHashLabel(const ImGuiLabel& label, ImU32 seed)
+{
+    return ImHashData(label.Label + label.HashedOffset, (size_t)label.HashedLen, seed);
+}
+#endif
+#endif // #ifdef IMGUI_HAS_CONSTEXPR_LABEL
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (File functions)
 //-----------------------------------------------------------------------------
@@ -1836,6 +2067,94 @@ static ImGuiStorage::ImGuiStoragePair* LowerBound(ImVector<ImGuiStorage::ImGuiSt
     return first;
 }
 
+// Hashed storage: linear probing from the slot of the key.
+// IDs are hashes already, but CRC32 IDs of similar inputs (e.g. PushID(int) in a loop) share bit patterns: a Fibonacci multiply mixes them first.
+static inline int HashSlotFirst(ImGuiID key, int slots_count)
+{
+    const ImU32 h = key * 0x9E3779B1u;
+    return (int)((h ^ (h >> 16)) & (ImU32)(slots_count - 1));
+}
+
+static void HashSlotsRebuild(ImGuiStorage& storage, int slots_count)
+{
+    storage.HashSlots.resize(slots_count);
+    memset(storage.HashSlots.Data, 0xFF, (size_t)storage.HashSlots.size_in_bytes());
+    for (int n = 0; n < storage.Data.Size; n++)
+    {
+        const ImGuiID key = storage.Data[n].key;
+        int slot_n = HashSlotFirst(key, slots_count);
+        while (storage.HashSlots[slot_n].index != -1)
+            slot_n = (slot_n + 1) & (slots_count - 1);
+        storage.HashSlots[slot_n].key = key;
+        storage.HashSlots[slot_n].index = n;
+    }
+}
+
+// Smallest power of 2 number of slots keeping 'pairs_count' at most 3/4 of them
+static int HashSlotsCalcCount(int pairs_count)
+{
+    int slots_count = 16;
+    while (pairs_count * 4 > slots_count * 3)
+        slots_count *= 2;
+    return slots_count;
+}
+
+static ImGuiStorage::ImGuiStoragePair* FindPair(const ImGuiStorage& storage, ImGuiID key)
+{
+    if (!storage.Hashed)
+    {
+        ImGuiStorage::ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStorage::ImGuiStoragePair>&>(storage.Data), key);
+        return (it == storage.Data.end() || it->key != key) ? NULL : it;
+    }
+    const int slots_count = storage.HashSlots.Size;
+    if (slots_count == 0)
+        return NULL;
+    for (int slot_n = HashSlotFirst(key, slots_count); ; slot_n = (slot_n + 1) & (slots_count - 1))
+    {
+        const ImGuiStorage::ImGuiStorageSlot& slot = storage.HashSlots.Data[slot_n];
+        if (slot.index == -1)
+            return NULL;
+        if (slot.key == key)
+            return &storage.Data.Data[slot.index];
+    }
+}
+
+// Add 'pair' if its key is missing. Return the pair of the key.
+static ImGuiStorage::ImGuiStoragePair* FindOrAddPair(ImGuiStorage& storage, const ImGuiStorage::ImGuiStoragePair& pair)
+{
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Storage);
+    if (!storage.Hashed)
+    {
+        ImGuiStorage::ImGuiStoragePair* it = LowerBound(storage.Data, pair.key);
+        if (it == storage.Data.end() || it->key != pair.key)
+            it = storage.Data.insert(it, pair);
+        return it;
+    }
+    if ((storage.Data.Size + 1) * 4 > storage.HashSlots.Size * 3)
+        HashSlotsRebuild(storage, HashSlotsCalcCount(storage.Data.Size + 1));
+    const int slots_count = storage.HashSlots.Size;
+    int slot_n = HashSlotFirst(pair.key, slots_count);
+    for (; storage.HashSlots.Data[slot_n].index != -1; slot_n = (slot_n + 1) & (slots_count - 1))
+        if (storage.HashSlots.Data[slot_n].key == pair.key)
+            return &storage.Data.Data[storage.HashSlots.Data[slot_n].index];
+    storage.HashSlots.Data[slot_n].key = pair.key;
+    storage.HashSlots.Data[slot_n].index = storage.Data.Size;
+    storage.Data.push_back(pair);
+    return &storage.Data.back();
+}
+
+// Switch between a sorted storage (most compact, O(log N) queries, O(N) insertions) and a hashed one (O(1) queries and insertions).
+// The pairs are kept. A hashed storage iterates its pairs in insertion order.
+void ImGuiStorage::SetHashed(bool hashed)
+{
+    if (Hashed == hashed)
+        return;
+    Hashed = hashed;
+    HashSlots.clear();
+    if (Data.Size > 0)
+        BuildSortByKey();
+}
+
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
@@ -1849,16 +2168,17 @@ void ImGuiStorage::BuildSortByKey()
             return 0;
         }
     };
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Storage);
     if (Data.Size > 1)
         ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), StaticFunc::PairCompareByID);
+    if (Hashed)
+        HashSlotsRebuild(*this, HashSlotsCalcCount(Data.Size));
 }
 
 int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_i;
+    const ImGuiStoragePair* it = FindPair(*this, key);
+    return it ? it->val_i : default_val;
 }
 
 bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
@@ -1868,27 +2188,20 @@ bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
 
 float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_f;
+    const ImGuiStoragePair* it = FindPair(*this, key);
+    return it ? it->val_f : default_val;
 }
 
 void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return NULL;
-    return it->val_p;
+    const ImGuiStoragePair* it = FindPair(*this, key);
+    return it ? it->val_p : NULL;
 }
 
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_i;
+    return &FindOrAddPair(*this, ImGuiStoragePair(key, default_val))->val_i;
 }
 
 bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
@@ -1898,30 +2211,18 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_f;
+    return &FindOrAddPair(*this, ImGuiStoragePair(key, default_val))->val_f;
 }
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_p;
+    return &FindOrAddPair(*this, ImGuiStoragePair(key, default_val))->val_p;
 }
 
 // FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_i = val;
+    FindOrAddPair(*this, ImGuiStoragePair(key, val))->val_i = val;
 }
 
 void ImGuiStorage::SetBool(ImGuiID key, bool val)
@@ -1931,24 +2232,12 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_f = val;
+    FindOrAddPair(*this, ImGuiStoragePair(key, val))->val_f = val;
 }
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_p = val;
+    FindOrAddPair(*this, ImGuiStoragePair(key, val))->val_p = val;
 }
 
 void ImGuiStorage::SetAllInt(int v)
@@ -2077,6 +2366,7 @@ char ImGuiTextBuffer::EmptyString[1] = { 0 };
 
 void ImGuiTextBuffer::append(const char* str, const char* str_end)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_TextBuffer);
     int len = str_end ? (int)(str_end - str) : (int)strlen(str);
 
     // Add zero-terminator the first time
@@ -2104,6 +2394,7 @@ void ImGuiTextBuffer::appendf(const char* fmt, ...)
 // Helper: Text buffer for logging/accumulating text
 void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_TextBuffer);
     va_list args_copy;
     va_copy(args_copy, args);
 
@@ -2128,6 +2419,72 @@ void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
     va_end(args_copy);
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImGuiFrameArena
+//-----------------------------------------------------------------------------
+
+void* ImGuiFrameArena::Alloc(size_t sz)
+{
+    Buffer& buf = Buffers[Epoch & 1];
+    sz = (sz + 15) & ~(size_t)15;
+    if (buf.Size + sz <= (size_t)buf.Capacity)
+    {
+        void* p = buf.Data + buf.Size;
+        buf.Size += (int)sz;
+        return p;
+    }
+
+    // First use: start with a size which fits the transient data of most applications
+    if (buf.Data == NULL && sz <= 16 * 1024)
+    {
+        buf.Capacity = 16 * 1024;
+        buf.Data = (char*)IM_ALLOC((size_t)buf.Capacity);
+        buf.Size = (int)sz;
+        return buf.Data;
+    }
+
+    // Buffer is full: fall back to the heap until Reset() recycles it
+    void* p = IM_ALLOC(sz);
+    buf.OverflowBlocks.push_back(p);
+    buf.OverflowSize += (int)sz;
+    return p;
+}
+
+void ImGuiFrameArena::Reset()
+{
+    Epoch++;
+    Buffer& buf = Buffers[Epoch & 1];
+    if (buf.OverflowSize > 0)
+    {
+        // Grow to fit everything allocated during the last frame which used this buffer, with some margin
+        const int new_capacity = buf.Size + buf.OverflowSize;
+        for (int n = 0; n < buf.OverflowBlocks.Size; n++)
+            IM_FREE(buf.OverflowBlocks[n]);
+        buf.OverflowBlocks.resize(0);
+        buf.OverflowSize = 0;
+        if (buf.Data)
+            IM_FREE(buf.Data);
+        buf.Capacity = ((new_capacity + new_capacity / 2) + 4095) & ~4095;
+        buf.Data = (char*)IM_ALLOC((size_t)buf.Capacity);
+    }
+    buf.Size = 0;
+}
+
+void ImGuiFrameArena::ClearFreeMemory()
+{
+    for (int buf_n = 0; buf_n < IM_ARRAYSIZE(Buffers); buf_n++)
+    {
+        Buffer& buf = Buffers[buf_n];
+        for (int n = 0; n < buf.OverflowBlocks.Size; n++)
+            IM_FREE(buf.OverflowBlocks[n]);
+        buf.OverflowBlocks.clear();
+        if (buf.Data)
+            IM_FREE(buf.Data);
+        buf.Data = NULL;
+        buf.Capacity = buf.Size = buf.OverflowSize = 0;
+    }
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiListClipper
 // This is currently not as flexible/powerful as it should be and really confusing/spaghetti, mostly because we changed
@@ -2536,8 +2893,28 @@ const char* ImGui::GetStyleColorName(ImGuiCol idx)
 const char* ImGui::FindRenderedTextEnd(const char* text, const char* text_end)
 {
     const char* text_display_end = text;
+#ifdef IMGUI_TEXT_USE_SSE2
+    // Find '#' and '\0' 16 bytes at once, the end needs to be known to not read past it
+    if (!text_end)
+        text_end = text + strlen(text);
+    const __m128i hash = _mm_set1_epi8('#');
+    const __m128i zero = _mm_setzero_si128();
+    while (text_end - text_display_end >= 16)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(const void*)text_display_end);
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, hash), _mm_cmpeq_epi8(v, zero)));
+        for (; mask != 0; mask &= mask - 1)
+        {
+            const char* p = text_display_end + ImCountTrailingZeros(mask);
+            if (*p == '\0' || p[1] == '#')     // Same test as below
+                return p;
+        }
+        text_display_end += 16;
+    }
+#else
     if (!text_end)
         text_end = (const char*)-1;
+#endif
 
     while (text_display_end < text_end && *text_display_end != '\0' && (text_display_end[0] != '#' || text_display_end[1] != '#'))
         text_display_end++;
@@ -2839,6 +3216,13 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* context, const char* name)
     NavRectRel[0] = NavRectRel[1] = ImRect();
     NavLastChildNavWindow = NULL;
 
+    DC.ItemFlagsStack.Arena = DC.ItemWidthStack.Arena = DC.TextWrapPosStack.Arena = &context->FrameArena;
+    DC.GroupStack.Arena = &context->FrameArena;
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+    AllocIdx = context->AllocWindows.Size;
+    context->AllocWindows.push_back(this);
+#endif
+
     MemoryCompacted = false;
     MemoryDrawListIdxCapacity = MemoryDrawListVtxCapacity = 0;
 }
@@ -2920,6 +3304,20 @@ ImGuiID ImGuiWindow::GetIDNoKeepAlive(int n)
     return id;
 }
 
+#ifdef IMGUI_HAS_CONSTEXPR_LABEL
+ImGuiID ImGuiWindow::GetID(const ImGuiLabel& label)
+{
+    ImGuiID seed = IDStack.back();
+    ImGuiID id = ImHashLabel(label, seed);
+    ImGui::KeepAliveID(id);
+#ifdef IMGUI_ENABLE_TEST_ENGINE
+    ImGuiContext& g = *GImGui;
+    IMGUI_TEST_ENGINE_ID_INFO2(id, ImGuiDataType_String, label.Label, NULL);
+#endif
+    return id;
+}
+#endif
+
 // This is only used in rare/specific situations to manufacture an ID out of nowhere.
 ImGuiID ImGuiWindow::GetIDFromRectangle(const ImRect& r_abs)
 {
@@ -2943,6 +3341,7 @@ static void SetCurrentWindow(ImGuiWindow* window)
 // Not freed:
 // - ImGuiWindow, ImGuiWindowSettings, Name
 // - StateStorage, ColumnsStorage (may hold useful data)
+// - DC stacks, which are allocated from the frame arena
 // This should have no noticeable visual effect. When the window reappear however, expect new allocation/buffer growth/copy cost.
 void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
 {
@@ -2952,10 +3351,6 @@ void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
     window->IDStack.clear();
     window->DrawList->_ClearFreeMemory();
     window->DC.ChildWindows.clear();
-    window->DC.ItemFlagsStack.clear();
-    window->DC.ItemWidthStack.clear();
-    window->DC.TextWrapPosStack.clear();
-    window->DC.GroupStack.clear();
 }
 
 void ImGui::GcAwakeTransientWindowBuffers(ImGuiWindow* window)
@@ -3241,7 +3636,31 @@ void* ImGui::MemAlloc(size_t size)
 {
     if (ImGuiContext* ctx = GImGui)
         ctx->IO.MetricsActiveAllocations++;
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+    ImGuiAllocHeader* hdr = (ImGuiAllocHeader*)GImAllocatorAllocFunc(size + sizeof(ImGuiAllocHeader), GImAllocatorUserData);
+    if (hdr == NULL)
+        return NULL;
+    hdr->Size = (ImU32)size;
+    hdr->ContextUid = 0;
+    hdr->WindowIdx = -1;
+    hdr->Tag = ImGuiAllocTag_Other;
+    if (ImGuiContext* ctx = GImGui)
+    {
+        hdr->ContextUid = ctx->AllocContextUid;
+        hdr->Tag = ctx->AllocTag;
+        ctx->AllocStats[hdr->Tag].OnAlloc(size);
+        ctx->AllocStatsTotal.OnAlloc(size);
+        ImGuiWindow* window = ctx->CurrentWindow;
+        if (window && window->AllocIdx < ctx->AllocWindows.Size)
+        {
+            hdr->WindowIdx = window->AllocIdx;
+            window->AllocStats.OnAlloc(size);
+        }
+    }
+    return hdr + 1;
+#else
     return GImAllocatorAllocFunc(size, GImAllocatorUserData);
+#endif
 }
 
 // IM_FREE() == ImGui::MemFree()
@@ -3250,9 +3669,35 @@ void ImGui::MemFree(void* ptr)
     if (ptr)
         if (ImGuiContext* ctx = GImGui)
             ctx->IO.MetricsActiveAllocations--;
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+    if (ptr)
+    {
+        // Memory freed while another context is current isn't subtracted from the live counters of its context
+        ImGuiAllocHeader* hdr = (ImGuiAllocHeader*)ptr - 1;
+        ImGuiContext* ctx = GImGui;
+        if (ctx && hdr->ContextUid != 0 && hdr->ContextUid == ctx->AllocContextUid)
+        {
+            ctx->AllocStats[hdr->Tag].OnFree(hdr->Size);
+            ctx->AllocStatsTotal.OnFree(hdr->Size);
+            if (hdr->WindowIdx >= 0 && hdr->WindowIdx < ctx->AllocWindows.Size)
+                ctx->AllocWindows.Data[hdr->WindowIdx]->AllocStats.OnFree(hdr->Size);
+        }
+        ptr = hdr;
+    }
+#endif
     return GImAllocatorFreeFunc(ptr, GImAllocatorUserData);
 }
 
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+const char* ImGui::DebugGetAllocTagName(ImGuiAllocTag tag)
+{
+    const char* names[] = { "Other", "DrawList", "Storage", "TextBuffer", "FontAtlas", "InputText" };
+    IM_ASSERT(IM_ARRAYSIZE(names) == ImGuiAllocTag_COUNT);
+    IM_ASSERT(tag >= 0 && tag < ImGuiAllocTag_COUNT);
+    return names[tag];
+}
+#endif
+
 const char* ImGui::GetClipboardText()
 {
     ImGuiContext& g = *GImGui;
@@ -3294,9 +3739,19 @@ void ImGui::SetAllocatorFunctions(void* (*alloc_func)(size_t sz, void* user_data
     GImAllocatorUserData = user_data;
 }
 
+void ImGui::GetAllocatorFunctions(void* (**p_alloc_func)(size_t sz, void* user_data), void (**p_free_func)(void* ptr, void* user_data), void** p_user_data)
+{
+    *p_alloc_func = GImAllocatorAllocFunc;
+    *p_free_func = GImAllocatorFreeFunc;
+    *p_user_data = GImAllocatorUserData;
+}
+
 ImGuiContext* ImGui::CreateContext(ImFontAtlas* shared_font_atlas)
 {
     ImGuiContext* ctx = IM_NEW(ImGuiContext)(shared_font_atlas);
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+    ctx->AllocContextUid = ++GImAllocContextUidCounter;
+#endif
     if (GImGui == NULL)
         SetCurrentContext(ctx);
     Initialize(ctx);
@@ -3336,6 +3791,17 @@ int ImGui::GetFrameCount()
     return GImGui->FrameCount;
 }
 
+float ImGui::GetEventWaitingTime()
+{
+    return GImGui->EventWaitingTime;
+}
+
+void ImGui::SetMaxWaitBeforeNextFrame(float seconds)
+{
+    ImGuiContext& g = *GImGui;
+    g.MaxWaitBeforeNextFrame = ImMin(g.MaxWaitBeforeNextFrame, ImMax(seconds, 0.0f));
+}
+
 ImDrawList* ImGui::GetBackgroundDrawList()
 {
     return &GImGui->BackgroundDrawList;
@@ -3660,6 +4126,91 @@ void ImGui::UpdateTabFocus()
     g.NavIdTabCounter = INT_MAX;
 }
 
+// Called by NewFrame() before updating input state: compare new inputs with the ones of the previous frame
+void ImGui::UpdateEventWaitingInputs()
+{
+    ImGuiContext& g = *GImGui;
+    const ImGuiIO& io = g.IO;
+    bool changed = (io.MouseWheel != 0.0f || io.MouseWheelH != 0.0f || io.InputQueueCharacters.Size > 0 || io.KeyMods != GetMergedKeyModFlags());
+    const ImVec2 mouse_pos = ImFloor(io.MousePos);
+    if (IsMousePosValid(&io.MousePos) != IsMousePosValid(&io.MousePosPrev) || (IsMousePosValid(&io.MousePos) && (mouse_pos.x != io.MousePosPrev.x || mouse_pos.y != io.MousePosPrev.y)))
+        changed = true;
+    for (int n = 0; n < IM_ARRAYSIZE(io.MouseDown) && !changed; n++)
+        changed = (io.MouseDown[n] != (io.MouseDownDuration[n] >= 0.0f));
+    for (int n = 0; n < IM_ARRAYSIZE(io.KeysDown) && !changed; n++)
+        changed = (io.KeysDown[n] != (io.KeysDownDuration[n] >= 0.0f));
+    for (int n = 0; n < IM_ARRAYSIZE(io.NavInputs) && !changed; n++)
+        changed = ((io.NavInputs[n] > 0.0f) != (io.NavInputsDownDuration[n] >= 0.0f));
+    if (changed)
+        g.EventWaitingSettleFrames = EVENT_WAITING_SETTLE_FRAMES;
+    else if (g.EventWaitingSettleFrames > 0)
+        g.EventWaitingSettleFrames--;
+}
+
+// Called by EndFrame(): how long can the application wait for new inputs before the UI needs a new frame?
+// Anything animated or spanning multiple frames (layout settling, scrolling, navigation, focus requests) needs a frame right away,
+// timers (key repeat, text cursor blinking, hover feedback, .ini saving) need one when they expire.
+float ImGui::CalcEventWaitingTime()
+{
+    ImGuiContext& g = *GImGui;
+    const ImGuiIO& io = g.IO;
+    if (g.FrameCount <= EVENT_WAITING_SETTLE_FRAMES || g.EventWaitingSettleFrames > 0 || io.WantSetMousePos)
+        return 0.0f;
+    if (g.HoveredId != g.HoveredIdPreviousFrame || g.ActiveId != g.ActiveIdPreviousFrame || g.DragDropActive)
+        return 0.0f;
+    if (g.NavMoveRequest || g.NavInitRequest || g.NavNextActivateId != 0 || g.NavMoveRequestForward != ImGuiNavForward_None || g.FocusRequestNextWindow != NULL)
+        return 0.0f;
+    if (g.NavWindowingTarget != NULL || g.NavWindowingHighlightAlpha > 0.0f || (GetTopMostPopupModal() != NULL ? g.DimBgRatio < 1.0f : g.DimBgRatio > 0.0f))
+        return 0.0f;
+    for (int n = 0; n < g.Windows.Size; n++)
+    {
+        ImGuiWindow* window = g.Windows[n];
+        if (!window->Active)
+            continue;
+        if (window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0 || window->HiddenFramesCannotSkipItems > 0) // HiddenFramesCanSkipItems is also set every frame on clipped child windows
+            return 0.0f;
+        if (window->ScrollTarget.x != FLT_MAX || window->ScrollTarget.y != FLT_MAX)
+            return 0.0f;
+    }
+    for (int n = 0; n < g.TabBars.GetSize(); n++)
+    {
+        ImGuiTabBar* tab_bar = g.TabBars.GetByIndex(n);
+        if (tab_bar->CurrFrameVisible == g.FrameCount && (tab_bar->ScrollingAnim != tab_bar->ScrollingTarget || tab_bar->NextSelectedTabId != 0 || tab_bar->WantLayout))
+            return 0.0f;
+    }
+
+    float wait_time = g.MaxWaitBeforeNextFrame;
+
+    // Held mouse buttons, keys and gamepad inputs: key repeat, button repeat, hold timers
+    bool any_held = false;
+    for (int n = 0; n < IM_ARRAYSIZE(io.MouseDown) && !any_held; n++)
+        any_held = io.MouseDown[n];
+    for (int n = 0; n < IM_ARRAYSIZE(io.KeysDown) && !any_held; n++)
+        any_held = io.KeysDown[n];
+    for (int n = 0; n < IM_ARRAYSIZE(io.NavInputs) && !any_held; n++)
+        any_held = (io.NavInputs[n] > 0.0f);
+    if (any_held)
+        wait_time = ImMin(wait_time, io.KeyRepeatRate);
+
+    // Text cursor blinking (see InputTextEx())
+    if (g.ActiveId != 0 && g.ActiveId == g.InputTextState.ID && io.ConfigInputTextCursorBlink)
+    {
+        const float cursor_anim = g.InputTextState.CursorAnim;
+        const float blink_phase = (cursor_anim <= 0.0f) ? cursor_anim : ImFmod(cursor_anim, 1.20f);
+        wait_time = ImMin(wait_time, (blink_phase <= 0.80f) ? 0.80f - blink_phase : 1.20f - blink_phase);
+    }
+
+    // Hover feedback
+    if (g.HoveredId != 0 && g.HoveredIdTimer < WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER)
+        wait_time = ImMin(wait_time, WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER - g.HoveredIdTimer);
+
+    // Saving .ini settings
+    if (g.SettingsDirtyTimer > 0.0f)
+        wait_time = ImMin(wait_time, g.SettingsDirtyTimer);
+
+    return wait_time;
+}
+
 // The reason this is exposed in imgui_internal.h is: on touch-based system that don't have hovering, we want to dispatch inputs to the right target (imgui vs imgui+app)
 void ImGui::UpdateHoveredWindowAndCaptureFlags()
 {
@@ -3745,6 +4296,15 @@ void ImGui::NewFrame()
     // Check and assert for various common IO and Configuration mistakes
     ErrorCheckNewFrameSanityChecks();
 
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+    // Allocations made from now on are accounted to the new frame
+    for (int n = 0; n < ImGuiAllocTag_COUNT; n++)
+        g.AllocStats[n].NewFrame();
+    g.AllocStatsTotal.NewFrame();
+    for (int n = 0; n < g.AllocWindows.Size; n++)
+        g.AllocWindows[n]->AllocStats.NewFrame();
+#endif
+
     // Load settings on first frame, save settings when modified (after a delay)
     UpdateSettings();
 
@@ -3763,6 +4323,8 @@ void ImGui::NewFrame()
 
     // Setup current font and draw list shared data
     g.IO.Fonts->Locked = true;
+    ImFontAtlasDynamicGlyphsNewFrame(g.IO.Fonts);
+    g.TextSizeCache.FrameCount = g.FrameCount;
     SetCurrentFont(GetDefaultFont());
     IM_ASSERT(g.Font->IsLoaded());
     g.DrawListSharedData.ClipRectFullscreen = ImVec4(0.0f, 0.0f, g.IO.DisplaySize.x, g.IO.DisplaySize.y);
@@ -3777,6 +4339,11 @@ void ImGui::NewFrame()
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset;
+    if (g.IO.ConfigRenderGlyphInstances && (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasGlyphInstances))
+    {
+        ImFontAtlasUpdateGlyphTable(g.IO.Fonts);
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_GlyphInstances;
+    }
 
     g.BackgroundDrawList._ResetForNewFrame();
     g.BackgroundDrawList.PushTextureID(g.IO.Fonts->TexID);
@@ -3789,6 +4356,11 @@ void ImGui::NewFrame()
     // Mark rendering data as invalid to prevent user who may have a handle on it to use it.
     g.DrawData.Clear();
 
+    // Recycle the transient memory of the frame before last. The draw lists of the previous frame stay readable (e.g. from the Metrics window), unless it wasn't rendered.
+    g.FrameArena.Reset();
+    if (g.FrameCountRendered != g.FrameCount - 1)
+        g.DrawDataBuilder.Clear();
+
     // Drag and drop keep the source ID alive so even if the source disappear our state is consistent
     if (g.DragDropActive && g.DragDropPayload.SourceId == g.ActiveId)
         KeepAliveID(g.DragDropPayload.SourceId);
@@ -3837,6 +4409,10 @@ void ImGui::NewFrame()
     g.DragDropWithinTarget = false;
     g.DragDropHoldJustPressedId = 0;
 
+    // Detect input changes before updating input state
+    UpdateEventWaitingInputs();
+    g.MaxWaitBeforeNextFrame = FLT_MAX;
+
     // Update keyboard input state
     // Synchronize io.KeyMods with individual modifiers io.KeyXXX bools
     g.IO.KeyMods = GetMergedKeyModFlags();
@@ -4008,6 +4584,9 @@ void ImGui::Shutdown(ImGuiContext* context)
 #endif
 
     // Clear everything else
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+    g.AllocWindows.clear();     // Stop accounting to windows before destroying them
+#endif
     for (int i = 0; i < g.Windows.Size; i++)
         IM_DELETE(g.Windows[i]);
     g.Windows.clear();
@@ -4026,12 +4605,14 @@ void ImGui::Shutdown(ImGuiContext* context)
     g.OpenPopupStack.clear();
     g.BeginPopupStack.clear();
     g.DrawDataBuilder.ClearFreeMemory();
+    g.FrameArena.ClearFreeMemory();
     g.BackgroundDrawList._ClearFreeMemory();
     g.ForegroundDrawList._ClearFreeMemory();
 
     g.TabBars.Clear();
     g.CurrentTabBarStack.clear();
     g.ShrinkWidthBuffer.clear();
+    g.TextSizeCache.Clear();
 
     g.ClipboardHandlerData.clear();
     g.MenusIdSubmittedThisFrame.clear();
@@ -4065,7 +4646,7 @@ static int IMGUI_CDECL ChildWindowComparer(const void* lhs, const void* rhs)
     return (a->BeginOrderWithinParent - b->BeginOrderWithinParent);
 }
 
-static void AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, ImGuiWindow* window)
+static void AddWindowToSortBuffer(ImFrameVector<ImGuiWindow*>* out_sorted_windows, ImGuiWindow* window)
 {
     out_sorted_windows->push_back(window);
     if (window->Active)
@@ -4082,7 +4663,7 @@ static void AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, Im
     }
 }
 
-static void AddDrawListToDrawData(ImVector<ImDrawList*>* out_list, ImDrawList* draw_list)
+static void AddDrawListToDrawData(ImFrameVector<ImDrawList*>* out_list, ImDrawList* draw_list)
 {
     // Remove trailing command if unused.
     // Technically we could return directly instead of popping, but this make things looks neat in Metrics window as well.
@@ -4118,7 +4699,7 @@ static void AddDrawListToDrawData(ImVector<ImDrawList*>* out_list, ImDrawList* d
     out_list->push_back(draw_list);
 }
 
-static void AddWindowToDrawData(ImVector<ImDrawList*>* out_render_list, ImGuiWindow* window)
+static void AddWindowToDrawData(ImFrameVector<ImDrawList*>* out_render_list, ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
     g.IO.MetricsRenderWindows++;
@@ -4148,7 +4729,7 @@ void ImDrawDataBuilder::FlattenIntoSingleLayer()
     Layers[0].resize(size);
     for (int layer_n = 1; layer_n < IM_ARRAYSIZE(Layers); layer_n++)
     {
-        ImVector<ImDrawList*>& layer = Layers[layer_n];
+        ImFrameVector<ImDrawList*>& layer = Layers[layer_n];
         if (layer.empty())
             continue;
         memcpy(&Layers[0][n], &layer[0], layer.Size * sizeof(ImDrawList*));
@@ -4157,13 +4738,172 @@ void ImDrawDataBuilder::FlattenIntoSingleLayer()
     }
 }
 
-static void SetupDrawData(ImVector<ImDrawList*>* draw_lists, ImDrawData* draw_data)
+// Area in which vertices of a command can't be affected by its clip rectangle.
+// The clip rectangle is rounded inward to integers as back-ends may round scissor rectangles either way, then extended by half a pixel: geometry
+// extending less than half a pixel past a scissor edge can only reach pixel centers lying exactly on that edge, which is the outer edge of
+// anti-aliased fringes (alpha 0) for what ImDrawList outputs, e.g. the border of a child window.
+static ImRect GetDrawCmdUnclippedRect(const ImVec4& clip_rect)
+{
+    return ImRect(ImCeil(clip_rect.x) - 0.5f, ImCeil(clip_rect.y) - 0.5f, ImFloorStd(clip_rect.z) + 0.5f, ImFloorStd(clip_rect.w) + 0.5f);
+}
+
+// Merge the draw commands of consecutive draw lists of Layers[0] into draw lists owned by the builder, to reduce the number of draw calls.
+// Two consecutive commands are merged when they use the same texture and drawing both with a single clip rectangle produces the same pixels:
+// - either they have the same clip rectangle,
+// - or the vertices of one command lie within the unclipped area of its own clip rectangle and of the other one, so it doesn't rely on clipping.
+// Draw lists with user callbacks, or using ImDrawCmd::VtxOffset to go past the 64K vertices limit of 16-bit indices, are passed through unmodified.
+// A command draws its triangles before its glyph instances, so a command with glyphs is only merged with a following one without triangles.
+void ImDrawDataBuilder::MergeDrawLists(ImDrawListSharedData* shared_data)
+{
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_DrawList);
+    ImFrameVector<ImDrawList*>& src_lists = Layers[0];
+    ImFrameVector<ImDrawList*>& dst_lists = Layers[1];
+    IM_ASSERT(dst_lists.Size == 0 && "Call FlattenIntoSingleLayer() first.");
+    const ImDrawGlyphQuad* glyph_table = shared_data->Font->ContainerAtlas->GlyphTable.Data;
+
+    ImDrawList* dst = NULL;
+    int merged_lists_count = 0;
+    ImRect merged_bounds;                   // Bounding box of the vertices of the last command of 'dst'
+    bool merged_clip_required = false;      // Set when some vertices of the last command of 'dst' rely on its clip rectangle
+    for (int list_n = 0; list_n < src_lists.Size; list_n++)
+    {
+        ImDrawList* src = src_lists[list_n];
+        bool pass_through = (sizeof(ImDrawIdx) == 2 && src->VtxBuffer.Size > (1 << 16));
+        for (int cmd_n = 0; cmd_n < src->CmdBuffer.Size && !pass_through; cmd_n++)
+            pass_through = (src->CmdBuffer.Data[cmd_n].UserCallback != NULL);
+        if (pass_through)
+        {
+            dst_lists.push_back(src);
+            dst = NULL;
+            continue;
+        }
+
+        // Start a new merged draw list when indices wouldn't fit
+        if (dst == NULL || (sizeof(ImDrawIdx) == 2 && dst->VtxBuffer.Size + src->VtxBuffer.Size > (1 << 16)))
+        {
+            if (merged_lists_count == MergedLists.Size)
+            {
+                ImDrawList* draw_list = IM_NEW(ImDrawList)(shared_data);
+                draw_list->_OwnerName = "##Merged";
+                MergedLists.push_back(draw_list);
+            }
+            dst = MergedLists[merged_lists_count++];
+            dst->CmdBuffer.resize(0);
+            dst->IdxBuffer.resize(0);
+            dst->VtxBuffer.resize(0);
+            dst->GlyphBuffer.resize(0);
+            dst_lists.push_back(dst);
+        }
+
+        const unsigned int vtx_base = (unsigned int)dst->VtxBuffer.Size;
+        dst->VtxBuffer.resize(dst->VtxBuffer.Size + src->VtxBuffer.Size);
+        memcpy(dst->VtxBuffer.Data + vtx_base, src->VtxBuffer.Data, (size_t)src->VtxBuffer.size_in_bytes());
+        const unsigned int glyph_base = (unsigned int)dst->GlyphBuffer.Size;
+        dst->GlyphBuffer.resize(dst->GlyphBuffer.Size + src->GlyphBuffer.Size);
+        if (src->GlyphBuffer.Size > 0)
+            memcpy(dst->GlyphBuffer.Data + glyph_base, src->GlyphBuffer.Data, (size_t)src->GlyphBuffer.size_in_bytes());
+        dst->IdxBuffer.reserve(dst->IdxBuffer.Size + src->IdxBuffer.Size);
+        for (int cmd_n = 0; cmd_n < src->CmdBuffer.Size; cmd_n++)
+        {
+            const ImDrawCmd* src_cmd = &src->CmdBuffer.Data[cmd_n];
+            if (src_cmd->ElemCount == 0 && src_cmd->GlyphCount == 0)
+                continue;
+
+            // Copy indices, rebased on the merged vertex buffer, and measure the bounding box of the vertices they reference
+            const int idx_offset = dst->IdxBuffer.Size;
+            dst->IdxBuffer.resize(idx_offset + (int)src_cmd->ElemCount);
+            const ImDrawIdx* src_idx = src->IdxBuffer.Data + src_cmd->IdxOffset;
+            ImDrawIdx* dst_idx = dst->IdxBuffer.Data + idx_offset;
+            const ImDrawVert* src_vtx = src->VtxBuffer.Data + src_cmd->VtxOffset;
+            const unsigned int idx_delta = vtx_base + src_cmd->VtxOffset;
+            ImVec2 bounds_min(FLT_MAX, FLT_MAX), bounds_max(-FLT_MAX, -FLT_MAX);
+            for (unsigned int n = 0; n < src_cmd->ElemCount; n++)
+            {
+                const ImVec2 pos = src_vtx[src_idx[n]].pos;
+                bounds_min = ImMin(bounds_min, pos);
+                bounds_max = ImMax(bounds_max, pos);
+                dst_idx[n] = (ImDrawIdx)(src_idx[n] + idx_delta);
+            }
+            const unsigned int glyph_offset = glyph_base + src_cmd->GlyphOffset;
+            for (unsigned int n = 0; n < src_cmd->GlyphCount; n++)
+            {
+                const ImDrawGlyph& glyph = dst->GlyphBuffer.Data[glyph_offset + n];
+                const ImDrawGlyphQuad& quad = glyph_table[glyph.GlyphIndex];
+                bounds_min = ImMin(bounds_min, ImVec2(glyph.Pos.x + quad.X0 * glyph.Scale, glyph.Pos.y + quad.Y0 * glyph.Scale));
+                bounds_max = ImMax(bounds_max, ImVec2(glyph.Pos.x + quad.X1 * glyph.Scale, glyph.Pos.y + quad.Y1 * glyph.Scale));
+            }
+            const ImRect cmd_bounds(bounds_min, bounds_max);
+            const ImRect cmd_clip = GetDrawCmdUnclippedRect(src_cmd->ClipRect);
+            const bool cmd_clip_required = !cmd_clip.Contains(cmd_bounds);
+
+            if (ImDrawCmd* prev_cmd = (dst->CmdBuffer.Size > 0) ? &dst->CmdBuffer.back() : NULL)
+            {
+                const ImRect prev_clip = GetDrawCmdUnclippedRect(prev_cmd->ClipRect);
+                bool merge = false;
+                if (prev_cmd->TextureId != src_cmd->TextureId)
+                {
+                    merge = false;
+                }
+                else if (prev_cmd->GlyphCount != 0 && (src_cmd->ElemCount != 0 || prev_cmd->GlyphOffset + prev_cmd->GlyphCount != glyph_offset))
+                {
+                    merge = false;          // Glyphs of the previous command would be drawn after the triangles of this one
+                }
+                else if (memcmp(&prev_cmd->ClipRect, &src_cmd->ClipRect, sizeof(ImVec4)) == 0)
+                {
+                    merge = true;
+                    merged_clip_required |= cmd_clip_required;
+                }
+                else if (!cmd_clip_required && prev_clip.Contains(cmd_bounds))
+                {
+                    merge = true;           // Keep the previous clip rectangle
+                }
+                else if (!merged_clip_required && cmd_clip.Contains(merged_bounds))
+                {
+                    merge = true;           // Previous vertices don't need clipping: switch to the new clip rectangle
+                    merged_clip_required = cmd_clip_required;
+                    prev_cmd->ClipRect = src_cmd->ClipRect;
+                }
+                if (merge)
+                {
+                    if (prev_cmd->GlyphCount == 0)
+                        prev_cmd->GlyphOffset = glyph_offset;
+                    prev_cmd->ElemCount += src_cmd->ElemCount;
+                    prev_cmd->GlyphCount += src_cmd->GlyphCount;
+                    merged_bounds.Add(cmd_bounds);
+                    continue;
+                }
+            }
+
+            ImDrawCmd cmd = *src_cmd;
+            cmd.VtxOffset = 0;
+            cmd.IdxOffset = (unsigned int)idx_offset;
+            cmd.GlyphOffset = glyph_offset;
+            dst->CmdBuffer.push_back(cmd);
+            merged_bounds = cmd_bounds;
+            merged_clip_required = cmd_clip_required;
+        }
+    }
+    src_lists.swap(dst_lists);
+    dst_lists.resize(0);
+}
+
+static int CountDrawCalls(const ImFrameVector<ImDrawList*>& draw_lists)
+{
+    int count = 0;
+    for (int n = 0; n < draw_lists.Size; n++)
+        for (int cmd_n = 0; cmd_n < draw_lists.Data[n]->CmdBuffer.Size; cmd_n++)
+            if (draw_lists.Data[n]->CmdBuffer.Data[cmd_n].UserCallback == NULL)
+                count++;
+    return count;
+}
+
+static void SetupDrawData(ImFrameVector<ImDrawList*>* draw_lists, ImDrawData* draw_data)
 {
     ImGuiIO& io = ImGui::GetIO();
     draw_data->Valid = true;
     draw_data->CmdLists = (draw_lists->Size > 0) ? draw_lists->Data : NULL;
     draw_data->CmdListsCount = draw_lists->Size;
-    draw_data->TotalVtxCount = draw_data->TotalIdxCount = 0;
+    draw_data->TotalVtxCount = draw_data->TotalIdxCount = draw_data->TotalGlyphCount = 0;
     draw_data->DisplayPos = ImVec2(0.0f, 0.0f);
     draw_data->DisplaySize = io.DisplaySize;
     draw_data->FramebufferScale = io.DisplayFramebufferScale;
@@ -4171,6 +4911,7 @@ static void SetupDrawData(ImVector<ImDrawList*>* draw_lists, ImDrawData* draw_da
     {
         draw_data->TotalVtxCount += draw_lists->Data[n]->VtxBuffer.Size;
         draw_data->TotalIdxCount += draw_lists->Data[n]->IdxBuffer.Size;
+        draw_data->TotalGlyphCount += draw_lists->Data[n]->GlyphBuffer.Size;
     }
 }
 
@@ -4261,12 +5002,15 @@ void ImGui::EndFrame()
 
     // This usually assert if there is a mismatch between the ImGuiWindowFlags_ChildWindow / ParentWindow values and DC.ChildWindows[] in parents, aka we've done something wrong.
     IM_ASSERT(g.Windows.Size == g.WindowsTempSortBuffer.Size);
-    g.Windows.swap(g.WindowsTempSortBuffer);
+    memcpy(g.Windows.Data, g.WindowsTempSortBuffer.Data, (size_t)g.Windows.size_in_bytes());
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
 
     // Unlock font atlas
     g.IO.Fonts->Locked = false;
 
+    // Time before a new frame is needed if no new inputs arrive
+    g.EventWaitingTime = CalcEventWaitingTime();
+
     // Clear Input data for next frame
     g.IO.MouseWheel = g.IO.MouseWheelH = 0.0f;
     g.IO.InputQueueCharacters.resize(0);
@@ -4285,7 +5029,7 @@ void ImGui::Render()
     g.DrawDataBuilder.Clear();
 
     // Add background ImDrawList
-    if (!g.BackgroundDrawList.VtxBuffer.empty())
+    if (!g.BackgroundDrawList.VtxBuffer.empty() || !g.BackgroundDrawList.GlyphBuffer.empty())
         AddDrawListToDrawData(&g.DrawDataBuilder.Layers[0], &g.BackgroundDrawList);
 
     // Add ImDrawList to render
@@ -4308,9 +5052,17 @@ void ImGui::Render()
         RenderMouseCursor(&g.ForegroundDrawList, g.IO.MousePos, g.Style.MouseCursorScale, g.MouseCursor, IM_COL32_WHITE, IM_COL32_BLACK, IM_COL32(0, 0, 0, 48));
 
     // Add foreground ImDrawList
-    if (!g.ForegroundDrawList.VtxBuffer.empty())
+    if (!g.ForegroundDrawList.VtxBuffer.empty() || !g.ForegroundDrawList.GlyphBuffer.empty())
         AddDrawListToDrawData(&g.DrawDataBuilder.Layers[0], &g.ForegroundDrawList);
 
+    // Merge draw commands across draw lists (optional)
+    g.IO.MetricsRenderDrawCallsUnmerged = g.IO.MetricsRenderDrawCalls = CountDrawCalls(g.DrawDataBuilder.Layers[0]);
+    if (g.IO.ConfigRenderMergeDrawLists)
+    {
+        g.DrawDataBuilder.MergeDrawLists(&g.DrawListSharedData);
+        g.IO.MetricsRenderDrawCalls = CountDrawCalls(g.DrawDataBuilder.Layers[0]);
+    }
+
     // Setup ImDrawData structure for end-user
     SetupDrawData(&g.DrawDataBuilder.Layers[0], &g.DrawData);
     g.IO.MetricsRenderVertices = g.DrawData.TotalVtxCount;
@@ -4323,6 +5075,125 @@ void ImGui::Render()
 #endif
 }
 
+ImGuiTextSizeCacheEntry* ImGuiTextSizeCache::GetOrAddEntry(ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end, bool* p_found)
+{
+    // Sizes computed with another atlas build may be wrong
+    ImFontAtlas* atlas = font->ContainerAtlas;
+    if (Atlas != atlas || AtlasBuildGeneration != atlas->BuildGeneration)
+    {
+        Clear();
+        Atlas = atlas;
+        AtlasBuildGeneration = atlas->BuildGeneration;
+    }
+    const int text_waste = TextBuffer.Size - UsedTextBytes;
+    if ((UsedCount + 1) * 4 > Entries.Size * 3 || (text_waste > IM_TEXT_SIZE_CACHE_MIN_TEXT_WASTE && text_waste > UsedTextBytes))
+        Rehash();
+
+    // Hash the displayed text 8 bytes at a time: ImHashData() goes byte per byte with the default CRC32 and would cost as much as measuring a short label.
+    // (ImHashStr() would also give "a###b" and "c###b" the same hash)
+    const ImU64 k = 0x9E3779B97F4A7C15ULL;
+    ImU32 size_bits[2];
+    memcpy(&size_bits[0], &font_size, sizeof(float));
+    memcpy(&size_bits[1], &wrap_width, sizeof(float));
+    const int text_length = (int)(text_end - text);
+    ImU64 h = ((ImU64)(size_t)font ^ ((ImU64)size_bits[0] << 32 | size_bits[1]) ^ (ImU64)text_length) * k;
+    const char* p = text;
+    for (; p + 8 <= text_end; p += 8)
+    {
+        ImU64 v;
+        memcpy(&v, p, 8);
+        h = (h ^ v) * k;
+        h ^= h >> 31;
+    }
+    if (p < text_end)
+    {
+        ImU64 v = 0;
+        memcpy(&v, p, (size_t)(text_end - p));
+        h = (h ^ v) * k;
+    }
+    h ^= h >> 33;   // Bring the high bits down: the low bits select the slot
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    const ImU64 hash = h;
+
+    // Search until an empty slot, remembering the first slot we may reuse
+    const int mask = Entries.Size - 1;
+    ImGuiTextSizeCacheEntry* free_entry = NULL;
+    for (int n = (int)(hash & mask); ; n = (n + 1) & mask)
+    {
+        ImGuiTextSizeCacheEntry* entry = &Entries.Data[n];
+        if (entry->Font == NULL)
+        {
+            if (free_entry == NULL)
+            {
+                free_entry = entry;
+                UsedCount++;
+            }
+            break;
+        }
+        if (entry->TextHash == hash && entry->Font == font && entry->TextLength == text_length && entry->FontSize == font_size && entry->WrapWidth == wrap_width
+            && memcmp(TextBuffer.Data + entry->TextOffset, text, (size_t)text_length) == 0)
+        {
+            entry->LastUsedFrame = FrameCount;
+            *p_found = true;
+            return entry;
+        }
+        if (free_entry == NULL && entry->LastUsedFrame < FrameCount - 1)
+            free_entry = entry;
+    }
+
+    // The text of a replaced stale entry stays in TextBuffer until the next rehash
+    if (free_entry->Font != NULL)
+        UsedTextBytes -= free_entry->TextLength;
+    free_entry->Font = font;
+    free_entry->FontSize = font_size;
+    free_entry->WrapWidth = wrap_width;
+    free_entry->TextHash = hash;
+    free_entry->TextOffset = TextBuffer.Size;
+    free_entry->TextLength = text_length;
+    TextBuffer.resize(TextBuffer.Size + text_length);
+    memcpy(TextBuffer.Data + free_entry->TextOffset, text, (size_t)text_length);
+    UsedTextBytes += text_length;
+    free_entry->LastUsedFrame = FrameCount;
+    *p_found = false;
+    return free_entry;
+}
+
+void ImGuiTextSizeCache::Rehash()
+{
+    int live_count = 0;
+    for (int n = 0; n < Entries.Size; n++)
+        if (Entries.Data[n].Font != NULL && Entries.Data[n].LastUsedFrame >= FrameCount - 1)
+            live_count++;
+    int new_capacity = IM_TEXT_SIZE_CACHE_MIN_CAPACITY;
+    while (new_capacity < live_count * 2)
+        new_capacity *= 2;
+
+    ImVector<ImGuiTextSizeCacheEntry> old_entries;
+    ImVector<char> old_text_buffer;
+    old_entries.swap(Entries);
+    old_text_buffer.swap(TextBuffer);
+    Entries.resize(new_capacity, ImGuiTextSizeCacheEntry());
+    TextBuffer.reserve(UsedTextBytes);
+    UsedCount = UsedTextBytes = 0;
+    const int mask = new_capacity - 1;
+    for (int old_n = 0; old_n < old_entries.Size; old_n++)
+    {
+        const ImGuiTextSizeCacheEntry* old_entry = &old_entries.Data[old_n];
+        if (old_entry->Font == NULL || old_entry->LastUsedFrame < FrameCount - 1)
+            continue;
+        int n = (int)(old_entry->TextHash & mask);
+        while (Entries.Data[n].Font != NULL)
+            n = (n + 1) & mask;
+        Entries.Data[n] = *old_entry;
+        Entries.Data[n].TextOffset = TextBuffer.Size;
+        TextBuffer.resize(TextBuffer.Size + old_entry->TextLength);
+        memcpy(TextBuffer.Data + Entries.Data[n].TextOffset, old_text_buffer.Data + old_entry->TextOffset, (size_t)old_entry->TextLength);
+        UsedTextBytes += old_entry->TextLength;
+        UsedCount++;
+    }
+}
+
 // Calculate text size. Text can be multi-line. Optionally ignore text after a ## marker.
 // CalcTextSize("") should return ImVec2(0.0f, g.FontSize)
 ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_text_after_double_hash, float wrap_width)
@@ -4339,11 +5210,30 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
+
+    // Labels are mostly the same from one frame to the next: reuse their size
+    ImGuiTextSizeCacheEntry* cache_entry = NULL;
+    if (g.TextSizeCache.Enabled)
+    {
+        if (text_display_end == NULL)
+            text_display_end = text + strlen(text);
+        bool found;
+        cache_entry = g.TextSizeCache.GetOrAddEntry(font, font_size, wrap_width, text, text_display_end, &found);
+        if (found)
+        {
+            g.TextSizeCache.HitsCount++;
+            return cache_entry->Size;
+        }
+        g.TextSizeCache.MissesCount++;
+    }
+
     ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
 
     // Round
     text_size.x = IM_FLOOR(text_size.x + 0.95f);
 
+    if (cache_entry)
+        cache_entry->Size = text_size;
     return text_size;
 }
 
@@ -4819,6 +5709,14 @@ bool ImGui::BeginChild(ImGuiID id, const ImVec2& size_arg, bool border, ImGuiWin
     return BeginChildEx(NULL, id, size_arg, border, extra_flags);
 }
 
+#ifdef IMGUI_HAS_CONSTEXPR_LABEL
+bool ImGui::BeginChild(const ImGuiLabel& str_id, const ImVec2& size_arg, bool border, ImGuiWindowFlags extra_flags)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    return BeginChildEx(str_id.Label, window->GetID(str_id), size_arg, border, extra_flags);
+}
+#endif
+
 void ImGui::EndChild()
 {
     ImGuiContext& g = *GImGui;
@@ -5929,7 +6827,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         {
             bool render_decorations_in_parent = false;
             if ((flags & ImGuiWindowFlags_ChildWindow) && !(flags & ImGuiWindowFlags_Popup) && !window_is_child_tooltip)
-                if (window->DrawList->CmdBuffer.back().ElemCount == 0 && parent_window->DrawList->VtxBuffer.Size > 0)
+                if (window->DrawList->CmdBuffer.back().ElemCount == 0 && (parent_window->DrawList->VtxBuffer.Size > 0 || parent_window->DrawList->GlyphBuffer.Size > 0))
                     render_decorations_in_parent = true;
             if (render_decorations_in_parent)
                 window->DrawList = parent_window->DrawList;
@@ -6822,6 +7720,14 @@ ImGuiID ImGui::GetID(const void* ptr_id)
     return window->GetID(ptr_id);
 }
 
+#ifdef IMGUI_HAS_CONSTEXPR_LABEL
+ImGuiID ImGui::GetID(const ImGuiLabel& str_id)
+{
+    ImGuiWindow* window = GImGui->CurrentWindow;
+    return window->GetID(str_id);
+}
+#endif
+
 bool ImGui::IsRectVisible(const ImVec2& size)
 {
     ImGuiWindow* window = GImGui->CurrentWindow;
@@ -6853,6 +7759,9 @@ bool ImGui::DebugCheckVersionAndDataLayout(const char* version, size_t sz_io, si
     if (sz_vec2 != sizeof(ImVec2)) { error = true; IM_ASSERT(sz_vec2 == sizeof(ImVec2) && "Mismatched struct layout!"); }
     if (sz_vec4 != sizeof(ImVec4)) { error = true; IM_ASSERT(sz_vec4 == sizeof(ImVec4) && "Mismatched struct layout!"); }
     if (sz_vert != sizeof(ImDrawVert)) { error = true; IM_ASSERT(sz_vert == sizeof(ImDrawVert) && "Mismatched struct layout!"); }
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    if (sizeof(ImDrawVert) != 12) { error = true; IM_ASSERT(sizeof(ImDrawVert) == 12 && "IMGUI_USE_COMPACT_DRAWVERT expects a packed 12 bytes ImDrawVert!"); }
+#endif
     if (sz_idx != sizeof(ImDrawIdx)) { error = true; IM_ASSERT(sz_idx == sizeof(ImDrawIdx) && "Mismatched struct layout!"); }
     return !error;
 }
@@ -10362,8 +11271,16 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     ImGui::Text("Dear ImGui %s", ImGui::GetVersion());
     ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
     ImGui::Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
+    if (io.ConfigRenderMergeDrawLists)
+        ImGui::Text("%d draw calls (%d before merging draw lists)", io.MetricsRenderDrawCalls, io.MetricsRenderDrawCallsUnmerged);
+    else
+        ImGui::Text("%d draw calls", io.MetricsRenderDrawCalls);
     ImGui::Text("%d active windows (%d visible)", io.MetricsActiveWindows, io.MetricsRenderWindows);
     ImGui::Text("%d active allocations", io.MetricsActiveAllocations);
+    if (ImFontAtlasDynamicGlyphs* dyn = io.Fonts->DynamicGlyphs)
+        ImGui::Text("%d glyphs rasterized on demand, %d pages evicted, %d glyphs deferred", dyn->LoadsCount, dyn->EvictionsCount, dyn->DeferredCount);
+    ImGui::Text("Text size cache: %d/%d slots used, %d/%d text bytes used, %d hits, %d misses", g.TextSizeCache.UsedCount, g.TextSizeCache.Entries.Size, g.TextSizeCache.UsedTextBytes, g.TextSizeCache.TextBuffer.Size, g.TextSizeCache.HitsCount, g.TextSizeCache.MissesCount);
+    ImGui::Text("Frame arena: %d bytes used last frame, %d bytes reserved", g.FrameArena.GetFrameUsage(1), g.FrameArena.GetCapacity());
     ImGui::Separator();
 
     // Helper functions to display common structures:
@@ -10422,7 +11339,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
 
         static void NodeDrawList(ImGuiWindow* window, ImDrawList* draw_list, const char* label)
         {
-            bool node_open = ImGui::TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, draw_list->CmdBuffer.Size);
+            bool node_open = ImGui::TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d glyphs, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, draw_list->GlyphBuffer.Size, draw_list->CmdBuffer.Size);
             if (draw_list == ImGui::GetWindowDrawList())
             {
                 ImGui::SameLine();
@@ -10443,7 +11360,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             unsigned int elem_offset = 0;
             for (const ImDrawCmd* pcmd = draw_list->CmdBuffer.begin(); pcmd < draw_list->CmdBuffer.end(); elem_offset += pcmd->ElemCount, pcmd++)
             {
-                if (pcmd->UserCallback == NULL && pcmd->ElemCount == 0)
+                if (pcmd->UserCallback == NULL && pcmd->ElemCount == 0 && pcmd->GlyphCount == 0)
                     continue;
                 if (pcmd->UserCallback)
                 {
@@ -10453,8 +11370,8 @@ void ImGui::ShowMetricsWindow(bool* p_open)
 
                 ImDrawIdx* idx_buffer = (draw_list->IdxBuffer.Size > 0) ? draw_list->IdxBuffer.Data : NULL;
                 char buf[300];
-                ImFormatString(buf, IM_ARRAYSIZE(buf), "DrawCmd:%5d triangles, Tex 0x%p, ClipRect (%4.0f,%4.0f)-(%4.0f,%4.0f)",
-                    pcmd->ElemCount / 3, (void*)(intptr_t)pcmd->TextureId,
+                ImFormatString(buf, IM_ARRAYSIZE(buf), "DrawCmd:%5d triangles, %4d glyphs, Tex 0x%p, ClipRect (%4.0f,%4.0f)-(%4.0f,%4.0f)",
+                    pcmd->ElemCount / 3, pcmd->GlyphCount, (void*)(intptr_t)pcmd->TextureId,
                     pcmd->ClipRect.x, pcmd->ClipRect.y, pcmd->ClipRect.z, pcmd->ClipRect.w);
                 bool pcmd_node_open = ImGui::TreeNode((void*)(pcmd - draw_list->CmdBuffer.begin()), "%s", buf);
                 if (ImGui::IsItemHovered() && (show_drawcmd_mesh || show_drawcmd_aabb) && fg_draw_list)
@@ -10492,7 +11409,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
                             ImDrawVert& v = draw_list->VtxBuffer[idx_buffer ? idx_buffer[idx_i] : idx_i];
                             triangle[n] = v.pos;
                             buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
-                                (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
+                                (n == 0) ? "Vert:" : "     ", idx_i, (float)v.pos.x, (float)v.pos.y, (float)v.uv.x, (float)v.uv.y, v.col);
                         }
 
                         ImGui::Selectable(buf, false);
@@ -10581,9 +11498,20 @@ void ImGui::ShowMetricsWindow(bool* p_open)
                 ImGui::TreePop();
             }
             NodeStorage(&window->StateStorage, "Storage");
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+            NodeAllocStats("Allocations", window->AllocStats);
+#endif
             ImGui::TreePop();
         }
 
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+        static void NodeAllocStats(const char* label, const ImGuiAllocStats& stats)
+        {
+            ImGui::BulletText("%s: %d live (%d bytes, peak %d bytes), last frame: %d allocations (%d bytes)",
+                label, stats.LiveCount, (int)stats.LiveBytes, (int)stats.PeakBytes, stats.LastFrameAllocCount, (int)stats.LastFrameAllocBytes);
+        }
+#endif
+
         static void NodeWindowSettings(ImGuiWindowSettings* settings)
         {
             ImGui::Text("0x%08X \"%s\" Pos (%d,%d) Size (%d,%d) Collapsed=%d",
@@ -10626,7 +11554,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
 
         static void NodeStorage(ImGuiStorage* storage, const char* label)
         {
-            if (!ImGui::TreeNode(label, "%s: %d entries, %d bytes", label, storage->Data.Size, storage->Data.size_in_bytes()))
+            if (!ImGui::TreeNode(label, "%s: %d entries, %d bytes%s", label, storage->Data.Size, storage->Data.size_in_bytes() + storage->HashSlots.size_in_bytes(), storage->Hashed ? ", hashed" : ""))
                 return;
             for (int n = 0; n < storage->Data.Size; n++)
             {
@@ -10664,6 +11592,8 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         }
         ImGui::Checkbox("Show mesh when hovering ImDrawCmd", &show_drawcmd_mesh);
         ImGui::Checkbox("Show bounding boxes when hovering ImDrawCmd", &show_drawcmd_aabb);
+        ImGui::Checkbox("Merge draw lists (io.ConfigRenderMergeDrawLists)", &io.ConfigRenderMergeDrawLists);
+        ImGui::Checkbox("Text as glyph instances (io.ConfigRenderGlyphInstances)", &io.ConfigRenderGlyphInstances);
         ImGui::TreePop();
     }
 
@@ -10677,6 +11607,23 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         ImGui::TreePop();
     }
 
+    // Details for Allocations (IMGUI_ENABLE_ALLOC_TRACKING)
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+    if (ImGui::TreeNode("Allocations", "Allocations (%d live, %d bytes, %d last frame)", g.AllocStatsTotal.LiveCount, (int)g.AllocStatsTotal.LiveBytes, g.AllocStatsTotal.LastFrameAllocCount))
+    {
+        Funcs::NodeAllocStats("Total", g.AllocStatsTotal);
+        for (int n = 0; n < ImGuiAllocTag_COUNT; n++)
+            Funcs::NodeAllocStats(DebugGetAllocTagName((ImGuiAllocTag)n), g.AllocStats[n]);
+        if (ImGui::TreeNode("Windows", "Per window (%d)", g.AllocWindows.Size))
+        {
+            for (int n = 0; n < g.AllocWindows.Size; n++)
+                Funcs::NodeAllocStats(g.AllocWindows[n]->Name, g.AllocWindows[n]->AllocStats);
+            ImGui::TreePop();
+        }
+        ImGui::TreePop();
+    }
+#endif
+
     // Details for Popups
     if (ImGui::TreeNode("Popups", "Popups (%d)", g.OpenPopupStack.Size))
     {
@@ -10709,6 +11656,20 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     }
 #endif // #ifdef IMGUI_HAS_TABLE
 
+    // Details for Fonts (glyph index memory: dense first 4K page + sparse 4K pages, see ImFont::BuildLookupTable)
+    ImFontAtlas* atlas = g.IO.Fonts;
+    if (ImGui::TreeNode("Fonts", "Fonts (%d)", atlas->Fonts.Size))
+    {
+        for (int n = 0; n < atlas->Fonts.Size; n++)
+        {
+            ImFont* font = atlas->Fonts[n];
+            ImGui::BulletText("Font %d: \"%s\" %.2f px, %d glyphs, index %d bytes (dense %d, sparse pages %d)", n,
+                font->ConfigData ? font->ConfigData->Name : "", font->FontSize, font->Glyphs.Size,
+                font->GetIndexMemoryUsage(), font->IndexLookup.Size, font->IndexPagesLookup.Size / 4096);
+        }
+        ImGui::TreePop();
+    }
+
     // Details for Docking
 #ifdef IMGUI_HAS_DOCK
     if (ImGui::TreeNode("Dock nodes"))
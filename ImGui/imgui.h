@@ -92,6 +92,12 @@ Index of this file:
 #else
 #define IM_OFFSETOF(_TYPE,_MEMBER)  ((size_t)&(((_TYPE*)0)->_MEMBER))           // Offset of _MEMBER within _TYPE. Old style macro.
 #endif
+#if (__cplusplus >= 201402L) || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+#define IMGUI_HAS_CONSTEXPR_LABEL                                               // ImGuiLabel and IM_LABEL() need C++14 constexpr functions
+#endif
+#if defined(IMGUI_USE_HASH_CRC32C) && defined(IMGUI_USE_HASH_WYHASH)
+#error Define only one of IMGUI_USE_HASH_CRC32C and IMGUI_USE_HASH_WYHASH
+#endif
 
 // Warnings
 #if defined(__clang__)
@@ -114,18 +120,24 @@ Index of this file:
 struct ImDrawChannel;               // Temporary storage to output draw commands out of order, used by ImDrawListSplitter and ImDrawList::ChannelsSplit()
 struct ImDrawCmd;                   // A single draw command within a parent ImDrawList (generally maps to 1 GPU draw call, unless it is a callback)
 struct ImDrawData;                  // All draw command lists required to render the frame + pos/size coordinates to use for the projection matrix.
+struct ImDrawGlyph;                 // A glyph instance (pos + scale + col + glyph index = 20 bytes), output by text rendering instead of a quad when the renderer supports it
+struct ImDrawGlyphQuad;             // Quad of a glyph within ImFontAtlas::GlyphTable, used to expand ImDrawGlyph
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
-struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default, 12 bytes with IMGUI_USE_COMPACT_DRAWVERT. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
+struct ImFontAtlasDynamicGlyphs;    // Runtime data for glyphs rasterized on demand (see ImFontConfig::GlyphsOnDemand)
+struct ImFontAtlasPacker;           // Rectangle packer state kept by ImFontAtlas::Build() for ImFontAtlas::BuildAppend()
+struct ImFontAtlasTexRect;          // A rectangle within the font atlas texture
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
 struct ImFontGlyphRangesBuilder;    // Helper to build glyph ranges from text/string data
 struct ImColor;                     // Helper functions to create a color that can be converted to either u32 or float4 (*OBSOLETE* please avoid using)
 struct ImGuiContext;                // Dear ImGui context (opaque structure, unless including imgui_internal.h)
 struct ImGuiIO;                     // Main configuration and I/O between your application and ImGui
+struct ImGuiLabel;                  // String literal label with its ID hash computed at compile time, made by IM_LABEL()
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiListClipper;            // Helper to manually clip large list of items
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame, used by IMGUI_ONCE_UPON_A_FRAME macro
@@ -231,6 +243,30 @@ struct ImVec4
 #endif
 };
 
+#ifdef IMGUI_HAS_CONSTEXPR_LABEL
+// String literal label with its ID hash computed at compile time, for the ImGui:: functions taking an ImGuiLabel.
+// Use IM_LABEL("Label##id") to make one: it guarantees the hash is computed by the compiler, even in Debug builds.
+// CRC32 is linear, so hashing the label from any seed only needs its CRC from a zero register and its length (see ImHashLabel()).
+// With IMGUI_USE_HASH_CRC32C or IMGUI_USE_HASH_WYHASH only the position and length of the hashed part are computed at compile time.
+struct ImGuiLabel
+{
+    const char*     Label;          // Displayed up to "##", as any label
+    int             HashedOffset;   // Start of the hashed part of Label: its last "###", else 0
+    int             HashedLen;      // Length of the hashed part
+    ImU32           Crc;            // CRC of the hashed part, from a zero register and not inverted (0 with IMGUI_USE_HASH_CRC32C or IMGUI_USE_HASH_WYHASH)
+
+    constexpr explicit ImGuiLabel(const char* label) : Label(label), HashedOffset(CalcHashedOffset(label)), HashedLen(CalcLen(label + CalcHashedOffset(label))), Crc(CalcCrc(label + CalcHashedOffset(label))) {}
+    static constexpr int    CalcHashedOffset(const char* s) { int offset = 0; for (int i = 0; s[i]; i++) if (s[i] == '#' && s[i + 1] == '#' && s[i + 2] == '#') offset = i; return offset; }
+    static constexpr int    CalcLen(const char* s)          { int len = 0; while (s[len]) len++; return len; }
+#if !defined(IMGUI_USE_HASH_CRC32C) && !defined(IMGUI_USE_HASH_WYHASH)
+    static constexpr ImU32  CalcCrc(const char* s)          { ImU32 crc = 0; for (; *s; s++) { crc ^= (unsigned char)*s; for (int bit = 0; bit < 8; bit++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1))); } return crc; }
+#else
+    static constexpr ImU32  CalcCrc(const char*)            { return 0; }
+#endif
+};
+#define IM_LABEL(_LITERAL)          ([]() { constexpr ImGuiLabel label(_LITERAL); return label; }())    // Label hashed at compile time, e.g. Checkbox(IM_LABEL("Offscreen##27"), &v)
+#endif
+
 //-----------------------------------------------------------------------------
 // ImGui: Dear ImGui end-user API
 // (This is a namespace. You can add extra ImGui:: functions in your own separate file. Please don't modify imgui source files!)
@@ -419,6 +455,17 @@ namespace ImGui
     IMGUI_API ImGuiID       GetID(const char* str_id_begin, const char* str_id_end);
     IMGUI_API ImGuiID       GetID(const void* ptr_id);
 
+#ifdef IMGUI_HAS_CONSTEXPR_LABEL
+    // Labels hashed at compile time
+    // - Overloads taking an ImGuiLabel made by IM_LABEL("literal") instead of a string. They give the same IDs, "###" included,
+    //   but only combine the precomputed hash with the ID stack at run time instead of hashing the string every frame.
+    IMGUI_API ImGuiID       GetID(const ImGuiLabel& str_id);
+    IMGUI_API bool          Button(const ImGuiLabel& label, const ImVec2& size = ImVec2(0, 0));
+    IMGUI_API bool          Checkbox(const ImGuiLabel& label, bool* v);
+    IMGUI_API bool          BeginChild(const ImGuiLabel& str_id, const ImVec2& size = ImVec2(0, 0), bool border = false, ImGuiWindowFlags flags = 0);
+    IMGUI_API bool          BeginTabItem(const ImGuiLabel& label, bool* p_open = NULL, ImGuiTabItemFlags flags = 0);
+#endif
+
     // Widgets: Text
     IMGUI_API void          TextUnformatted(const char* text, const char* text_end = NULL); // raw text without formatting. Roughly equivalent to Text("%s", text) but: A) doesn't require null terminated string if 'text_end' is specified, B) it's faster, no memory copy is done, no buffer size limits, recommended for long chunks of text.
     IMGUI_API void          Text(const char* fmt, ...)                                      IM_FMTARGS(1); // formatted text
@@ -713,6 +760,8 @@ namespace ImGui
     IMGUI_API bool          IsRectVisible(const ImVec2& rect_min, const ImVec2& rect_max);      // test if rectangle (in screen space) is visible / not clipped. to perform coarse clipping on user's side.
     IMGUI_API double        GetTime();                                                          // get global imgui time. incremented by io.DeltaTime every frame.
     IMGUI_API int           GetFrameCount();                                                    // get global imgui frame count. incremented by 1 every frame.
+    IMGUI_API float         GetEventWaitingTime();                                              // get time in seconds the application may wait for new inputs before a new frame is needed (0.0f: needed now, FLT_MAX: only new inputs need a new frame). valid after EndFrame()/Render(). see imgui_frame_scheduler.h.
+    IMGUI_API void          SetMaxWaitBeforeNextFrame(float seconds);                           // request a new frame within 'seconds' even without new inputs, e.g. while animating something. reset every frame.
     IMGUI_API ImDrawList*   GetBackgroundDrawList();                                            // this draw list will be the first rendering one. Useful to quickly draw shapes/text behind dear imgui contents.
     IMGUI_API ImDrawList*   GetForegroundDrawList();                                            // this draw list will be the last rendered one. Useful to quickly draw shapes/text over dear imgui contents.
     IMGUI_API ImDrawListSharedData* GetDrawListSharedData();                                    // you may use this when creating your own ImDrawList instances.
@@ -782,6 +831,7 @@ namespace ImGui
     // - All those functions are not reliant on the current context.
     // - If you reload the contents of imgui.cpp at runtime, you may need to call SetCurrentContext() + SetAllocatorFunctions() again because we use global storage for those.
     IMGUI_API void          SetAllocatorFunctions(void* (*alloc_func)(size_t sz, void* user_data), void (*free_func)(void* ptr, void* user_data), void* user_data = NULL);
+    IMGUI_API void          GetAllocatorFunctions(void* (**p_alloc_func)(size_t sz, void* user_data), void (**p_free_func)(void* ptr, void* user_data), void** p_user_data);
     IMGUI_API void*         MemAlloc(size_t size);
     IMGUI_API void          MemFree(void* ptr);
 
@@ -1134,7 +1184,8 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasGamepad            = 1 << 0,   // Back-end Platform supports gamepad and currently has one connected.
     ImGuiBackendFlags_HasMouseCursors       = 1 << 1,   // Back-end Platform supports honoring GetMouseCursor() value to change the OS cursor shape.
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Back-end Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if ImGuiConfigFlags_NavEnableSetMousePos is set).
-    ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3    // Back-end Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Back-end Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasGlyphInstances = 1 << 4 // Back-end Renderer supports ImDrawCmd::GlyphCount: with io.ConfigRenderGlyphInstances, text is output as ImDrawGlyph instances (20 bytes per glyph instead of 4 vertices + 6 indices), expanded with ImFontAtlas::GlyphTable.
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -1537,6 +1588,8 @@ struct ImGuiIO
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // [BETA] Set to true to only allow moving windows when clicked+dragged from the title bar. Windows without a title bar are not affected.
     float       ConfigWindowsMemoryCompactTimer;// = 60.0f          // [BETA] Compact window memory usage when unused. Set to -1.0f to disable.
+    bool        ConfigRenderMergeDrawLists;     // = false          // [BETA] Merge the draw commands of consecutive windows into shared draw lists in Render() when they use the same texture and clipping allows it. Reduces draw calls, at the cost of copying vertices and indices every frame.
+    bool        ConfigRenderGlyphInstances;     // = false          // [BETA] Output text as ImDrawGlyph instances (fewer bytes to upload) when the renderer back-end supports it (ImGuiBackendFlags_RendererHasGlyphInstances). Text and triangles become two draw calls where they share a command: measure with your back-end before enabling.
 
     //------------------------------------------------------------------
     // Platform Functions
@@ -1607,6 +1660,8 @@ struct ImGuiIO
     float       Framerate;                      // Application framerate estimate, in frame per second. Solely for convenience. Rolling average estimation based on io.DeltaTime over 120 frames.
     int         MetricsRenderVertices;          // Vertices output during last call to Render()
     int         MetricsRenderIndices;           // Indices output during last call to Render() = number of triangles * 3
+    int         MetricsRenderDrawCalls;         // Draw commands (excluding user callbacks) output during last call to Render()
+    int         MetricsRenderDrawCallsUnmerged; // Draw commands (excluding user callbacks) before io.ConfigRenderMergeDrawLists merged them. Equal to MetricsRenderDrawCalls when disabled.
     int         MetricsRenderWindows;           // Number of visible windows
     int         MetricsActiveWindows;           // Number of active windows
     int         MetricsActiveAllocations;       // Number of active allocations, updated by MemAlloc/MemFree based on current context. May be off if you have multiple imgui contexts.
@@ -1853,13 +1908,28 @@ struct ImGuiStorage
         ImGuiStoragePair(ImGuiID _key, float _val_f)    { key = _key; val_f = _val_f; }
         ImGuiStoragePair(ImGuiID _key, void* _val_p)    { key = _key; val_p = _val_p; }
     };
+    struct ImGuiStorageSlot
+    {
+        ImGuiID key;
+        int     index;                      // Index of the pair in Data, -1 for an empty slot
+    };
 
-    ImVector<ImGuiStoragePair>      Data;
+    ImVector<ImGuiStoragePair>      Data;       // Sorted by key, or in insertion order when Hashed
+    ImVector<ImGuiStorageSlot>      HashSlots;  // Open addressing index into Data when Hashed (power of 2 size, at most 3/4 used)
+    bool                            Hashed;
 
     // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
-    void                Clear() { Data.clear(); }
+    // - A hashed storage (SetHashed(), or IMGUI_USE_HASHED_STORAGE in imconfig.h for all of them) has O(1) queries and insertions
+    //   for 8 more bytes per slot. Prefer it for storages of thousands of pairs, or with frequent insertions. Data can still be iterated.
+#ifdef IMGUI_USE_HASHED_STORAGE
+    ImGuiStorage()      { Hashed = true; }
+#else
+    ImGuiStorage()      { Hashed = false; }
+#endif
+    void                Clear() { Data.clear(); HashSlots.clear(); }
+    IMGUI_API void      SetHashed(bool hashed);
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -1882,6 +1952,7 @@ struct ImGuiStorage
     IMGUI_API void      SetAllInt(int val);
 
     // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
+    // (for a hashed storage this also rebuilds the index: call it after adding to Data directly)
     IMGUI_API void      BuildSortByKey();
 };
 
@@ -1991,6 +2062,9 @@ typedef void (*ImDrawCallback)(const ImDrawList* parent_list, const ImDrawCmd* c
 // - VtxOffset/IdxOffset: When 'io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset' is enabled,
 //   those fields allow us to render meshes larger than 64K vertices while keeping 16-bit indices.
 //   Pre-1.71 back-ends will typically ignore the VtxOffset/IdxOffset fields.
+// - GlyphOffset/GlyphCount: When 'io.BackendFlags & ImGuiBackendFlags_RendererHasGlyphInstances' and 'io.ConfigRenderGlyphInstances' are enabled,
+//   a command draws its ElemCount indices then its GlyphCount glyph instances, in this order, with the same clipping rectangle and texture.
+//   Triangles added after glyph instances share their command unless they overlap them.
 // - The ClipRect/TextureId/VtxOffset fields must be contiguous as we memcmp() them together (this is asserted for).
 struct ImDrawCmd
 {
@@ -1999,6 +2073,8 @@ struct ImDrawCmd
     unsigned int    VtxOffset;          // 4    // Start offset in vertex buffer. ImGuiBackendFlags_RendererHasVtxOffset: always 0, otherwise may be >0 to support meshes larger than 64K vertices with 16-bit indices.
     unsigned int    IdxOffset;          // 4    // Start offset in index buffer. Always equal to sum of ElemCount drawn so far.
     unsigned int    ElemCount;          // 4    // Number of indices (multiple of 3) to be rendered as triangles. Vertices are stored in the callee ImDrawList's vtx_buffer[] array, indices in idx_buffer[].
+    unsigned int    GlyphOffset;        // 4    // Start offset in glyph buffer (ImDrawList::GlyphBuffer).
+    unsigned int    GlyphCount;         // 4    // Number of glyph instances to be rendered after the triangles. Always 0 unless io.ConfigRenderGlyphInstances and ImGuiBackendFlags_RendererHasGlyphInstances are set.
     ImDrawCallback  UserCallback;       // 4-8  // If != NULL, call the function instead of rendering the vertices. clip_rect and texture_id will be set normally.
     void*           UserCallbackData;   // 4-8  // The draw callback code can access this.
 
@@ -2013,13 +2089,49 @@ typedef unsigned short ImDrawIdx;
 #endif
 
 // Vertex layout
-#ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#if !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT) && !defined(IMGUI_USE_COMPACT_DRAWVERT)
 struct ImDrawVert
 {
     ImVec2  pos;
     ImVec2  uv;
     ImU32   col;
 };
+#elif !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+// Compact vertex layout (pos + uv + col = 12 bytes), enabled by defining IMGUI_USE_COMPACT_DRAWVERT in imconfig.h
+// - pos: 16-bit signed fixed point with IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS fractional bits. The default of 3 gives a 1/8th pixel precision
+//   within -4096..+4095 (values outside are clamped). Renderers may read it as a normalized value and scale by IMGUI_COMPACT_DRAWVERT_POS_SCALE.
+// - uv: 16-bit normalized, clamped to 0..1 (no texture repeat).
+// - The components convert from/to float and ImVec2, so code written for the default layout works unchanged, but a renderer needs
+//   to declare the matching vertex format (see imgui_impl_dx11.cpp).
+#ifndef IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS
+#define IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS    3
+#endif
+#define IMGUI_COMPACT_DRAWVERT_POS_SCALE        (32767.0f / (float)(1 << IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS))  // Pixels per unit of a R16_SNORM position
+struct ImDrawVertPosComponent
+{
+    ImS16   Value;
+    ImDrawVertPosComponent& operator=(float f)  { f *= (float)(1 << IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS); f = (f < 32767.0f) ? f : 32767.0f; f = (f > -32768.0f) ? f : -32768.0f; Value = (ImS16)((int)(f + 32768.5f) - 32768); return *this; }
+    operator float() const                      { return (float)Value * (1.0f / (float)(1 << IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS)); }
+};
+struct ImDrawVertUvComponent
+{
+    ImU16   Value;
+    ImDrawVertUvComponent& operator=(float f)   { f = (f < 1.0f) ? f : 1.0f; f = (f > 0.0f) ? f : 0.0f; Value = (ImU16)(int)(f * 65535.0f + 0.5f); return *this; }
+    operator float() const                      { return (float)Value * (1.0f / 65535.0f); }
+};
+template<typename T>
+struct ImDrawVertVec2
+{
+    T       x, y;
+    ImDrawVertVec2& operator=(const ImVec2& v)  { x = v.x; y = v.y; return *this; }
+    operator ImVec2() const                     { return ImVec2(x, y); }
+};
+struct ImDrawVert
+{
+    ImDrawVertVec2<ImDrawVertPosComponent>  pos;
+    ImDrawVertVec2<ImDrawVertUvComponent>   uv;
+    ImU32                                   col;
+};
 #else
 // You can override the vertex format layout by defining IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT in imconfig.h
 // The code expect ImVec2 pos (8 bytes), ImVec2 uv (8 bytes), ImU32 col (4 bytes), but you can re-order them or add other fields as needed to simplify integration in your engine.
@@ -2028,6 +2140,24 @@ struct ImDrawVert
 IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT;
 #endif
 
+// Glyph instance, output by ImFont::RenderText() instead of 4 vertices + 6 indices when 'io.ConfigRenderGlyphInstances' and 'io.BackendFlags & ImGuiBackendFlags_RendererHasGlyphInstances'.
+// The renderer back-end expands it into the quad RenderText() would have written into VtxBuffer, with Quad = ImFontAtlas::GlyphTable[GlyphIndex]:
+//   positions (Pos.x + Quad.X0 * Scale, Pos.y + Quad.Y0 * Scale) - (Pos.x + Quad.X1 * Scale, Pos.y + Quad.Y1 * Scale), texture coordinates (Quad.U0, Quad.V0) - (Quad.U1, Quad.V1), color Col.
+struct ImDrawGlyph
+{
+    ImVec2  Pos;                // Pen position, in pixels
+    float   Scale;              // Font size / ImFont::FontSize
+    ImU32   Col;
+    ImU32   GlyphIndex;         // Index into ImFontAtlas::GlyphTable
+};
+
+// Quad of a glyph, in ImFontAtlas::GlyphTable
+struct ImDrawGlyphQuad
+{
+    float   X0, Y0, X1, Y1;     // Offsets from ImDrawGlyph::Pos, in pixels at scale 1.0f
+    float   U0, V0, U1, V1;     // Texture coordinates
+};
+
 // For use by ImDrawListSplitter.
 struct ImDrawChannel
 {
@@ -2074,7 +2204,8 @@ enum ImDrawListFlags_
     ImDrawListFlags_AntiAliasedLines        = 1 << 0,  // Enable anti-aliased lines/borders (*2 the number of triangles for 1.0f wide line or lines thin enough to be drawn using textures, otherwise *3 the number of triangles)
     ImDrawListFlags_AntiAliasedLinesUseTex  = 1 << 1,  // Enable anti-aliased lines/borders using textures when possible. Require back-end to render with bilinear filtering.
     ImDrawListFlags_AntiAliasedFill         = 1 << 2,  // Enable anti-aliased edge around filled shapes (rounded rectangles, circles).
-    ImDrawListFlags_AllowVtxOffset          = 1 << 3   // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_AllowVtxOffset          = 1 << 3,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_GlyphInstances          = 1 << 4   // Output text as ImDrawGlyph instances into GlyphBuffer. Set when 'io.ConfigRenderGlyphInstances' and 'ImGuiBackendFlags_RendererHasGlyphInstances' are enabled.
 };
 
 // Draw command list
@@ -2091,6 +2222,7 @@ struct ImDrawList
     ImVector<ImDrawCmd>     CmdBuffer;          // Draw commands. Typically 1 command = 1 GPU draw call, unless the command is a callback.
     ImVector<ImDrawIdx>     IdxBuffer;          // Index buffer. Each command consume ImDrawCmd::ElemCount of those
     ImVector<ImDrawVert>    VtxBuffer;          // Vertex buffer.
+    ImVector<ImDrawGlyph>   GlyphBuffer;        // Glyph instance buffer. Each command consume ImDrawCmd::GlyphCount of those, empty unless ImDrawListFlags_GlyphInstances.
     ImDrawListFlags         Flags;              // Flags, you may poke into these to adjust anti-aliasing settings per-primitive.
 
     // [Internal, used while building lists]
@@ -2104,9 +2236,12 @@ struct ImDrawList
     ImVector<ImVec2>        _Path;              // [Internal] current path building
     ImDrawCmd               _CmdHeader;         // [Internal] Template of active commands. Fields should match those of CmdBuffer.back().
     ImDrawListSplitter      _Splitter;          // [Internal] for channels api (note: prefer using your own persistent instance of ImDrawListSplitter!)
+    ImVec4                  _GlyphRect;         // [Internal] Bounding box (x1, y1, x2, y2) of the glyph instances of the current command
+    int                     _GlyphCheckIdx;     // [Internal] IdxBuffer.Size after the last glyph instances: triangles added since then are checked against _GlyphRect
+    int                     _GlyphCheckVtx;     // [Internal] VtxBuffer.Size after the last glyph instances
 
     // If you want to create ImDrawList instances, pass them ImGui::GetDrawListSharedData() or create and use your own ImDrawListSharedData (so you can use ImDrawList without ImGui)
-    ImDrawList(const ImDrawListSharedData* shared_data) { _Data = shared_data; Flags = ImDrawListFlags_None; _VtxCurrentIdx = 0; _VtxWritePtr = NULL; _IdxWritePtr = NULL; _OwnerName = NULL; }
+    ImDrawList(const ImDrawListSharedData* shared_data) { _Data = shared_data; Flags = ImDrawListFlags_None; _VtxCurrentIdx = 0; _VtxWritePtr = NULL; _IdxWritePtr = NULL; _OwnerName = NULL; _GlyphCheckIdx = _GlyphCheckVtx = 0; }
 
     ~ImDrawList() { _ClearFreeMemory(); }
     IMGUI_API void  PushClipRect(ImVec2 clip_rect_min, ImVec2 clip_rect_max, bool intersect_with_current_clip_rect = false);  // Render-level scissoring. This is passed down to your render function but not used for CPU-side coarse clipping. Prefer using higher-level ImGui::PushClipRect() to affect logic (hit-testing and widget culling)
@@ -2163,7 +2298,7 @@ struct ImDrawList
     // Advanced
     IMGUI_API void  AddCallback(ImDrawCallback callback, void* callback_data);  // Your rendering function must check for 'UserCallback' in ImDrawCmd and call the function instead of rendering triangles.
     IMGUI_API void  AddDrawCmd();                                               // This is useful if you need to forcefully create a new draw call (to allow for dependent rendering / blending). Otherwise primitives are merged into the same draw-call as much as possible
-    IMGUI_API ImDrawList* CloneOutput() const;                                  // Create a clone of the CmdBuffer/IdxBuffer/VtxBuffer.
+    IMGUI_API ImDrawList* CloneOutput() const;                                  // Create a clone of the CmdBuffer/IdxBuffer/VtxBuffer/GlyphBuffer.
 
     // Advanced: Channels
     // - Use to split render into layers. By switching channels to can render out-of-order (e.g. submit FG primitives before BG primitives)
@@ -2183,6 +2318,8 @@ struct ImDrawList
     IMGUI_API void  PrimRect(const ImVec2& a, const ImVec2& b, ImU32 col);      // Axis aligned rectangle (composed of two triangles)
     IMGUI_API void  PrimRectUV(const ImVec2& a, const ImVec2& b, const ImVec2& uv_a, const ImVec2& uv_b, ImU32 col);
     IMGUI_API void  PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, const ImVec2& d, const ImVec2& uv_a, const ImVec2& uv_b, const ImVec2& uv_c, const ImVec2& uv_d, ImU32 col);
+    IMGUI_API ImDrawGlyph* PrimReserveGlyphs(int glyph_count);                  // Glyph instances (ImDrawListFlags_GlyphInstances), drawn after the triangles of the current command
+    IMGUI_API void  PrimUnreserveGlyphs(int glyph_count);
     inline    void  PrimWriteVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)    { _VtxWritePtr->pos = pos; _VtxWritePtr->uv = uv; _VtxWritePtr->col = col; _VtxWritePtr++; _VtxCurrentIdx++; }
     inline    void  PrimWriteIdx(ImDrawIdx idx)                                     { *_IdxWritePtr = idx; _IdxWritePtr++; }
     inline    void  PrimVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)         { PrimWriteIdx((ImDrawIdx)_VtxCurrentIdx); PrimWriteVtx(pos, uv, col); } // Write vertex with unique index
@@ -2194,6 +2331,7 @@ struct ImDrawList
     IMGUI_API void  _OnChangedClipRect();
     IMGUI_API void  _OnChangedTextureID();
     IMGUI_API void  _OnChangedVtxOffset();
+    IMGUI_API void  _SplitGlyphOverlap();
 };
 
 // All draw data to render a Dear ImGui frame
@@ -2206,6 +2344,7 @@ struct ImDrawData
     int             CmdListsCount;          // Number of ImDrawList* to render
     int             TotalIdxCount;          // For convenience, sum of all ImDrawList's IdxBuffer.Size
     int             TotalVtxCount;          // For convenience, sum of all ImDrawList's VtxBuffer.Size
+    int             TotalGlyphCount;        // For convenience, sum of all ImDrawList's GlyphBuffer.Size
     ImVec2          DisplayPos;             // Upper-left position of the viewport to render (== upper-left of the orthogonal projection matrix to use)
     ImVec2          DisplaySize;            // Size of the viewport to render (== io.DisplaySize for the main viewport) (DisplayPos + DisplaySize == lower-right of the orthogonal projection matrix to use)
     ImVec2          FramebufferScale;       // Amount of pixels for each unit of DisplaySize. Based on io.DisplayFramebufferScale. Generally (1,1) on normal display, (2,2) on OSX with Retina display.
@@ -2213,7 +2352,7 @@ struct ImDrawData
     // Functions
     ImDrawData()    { Valid = false; Clear(); }
     ~ImDrawData()   { Clear(); }
-    void Clear()    { Valid = false; CmdLists = NULL; CmdListsCount = TotalVtxCount = TotalIdxCount = 0; DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.f, 0.f); } // The ImDrawList are owned by ImGuiContext!
+    void Clear()    { Valid = false; CmdLists = NULL; CmdListsCount = TotalVtxCount = TotalIdxCount = TotalGlyphCount = 0; DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.f, 0.f); } // The ImDrawList are owned by ImGuiContext!
     IMGUI_API void  DeIndexAllBuffers();                    // Helper to convert all buffers from indexed to non-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
     IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
 };
@@ -2241,6 +2380,8 @@ struct ImFontConfig
     unsigned int    RasterizerFlags;        // 0x00     // Settings for custom font rasterizer (e.g. ImGuiFreeType). Leave as zero if you aren't using one.
     float           RasterizerMultiply;     // 1.0f     // Brighten (>1.0f) or darken (<1.0f) font output. Brightening small fonts may be a good workaround to make them more readable.
     ImWchar         EllipsisChar;           // -1       // Explicitly specify unicode codepoint of ellipsis character. When fonts are being merged first specified ellipsis will be used.
+    bool            GlyphsOnDemand;         // false    // [BETA] Rasterize glyphs the first time they are drawn instead of baking them all in Build(), into pages of ImFontAtlas texture (see ImFontAtlas::DynamicPagesCount). For large ranges such as GetGlyphRangesChineseFull() of which a session only uses a few hundred glyphs. Keep FallbackChar and EllipsisChar in a source which isn't on demand.
+    bool            SignedDistanceField;    // false    // [BETA] Bake glyphs as signed distance fields instead of coverage, so they stay sharp at any scale (SetWindowFontScale(), io.FontGlobalScale, DPI changes) from a single atlas. Requires a renderer back-end with SDF support (see ImFontAtlas::TexSdfMinY). OversampleH/V and RasterizerMultiply are ignored. Not compatible with GlyphsOnDemand.
 
     // [Internal]
     char            Name[40];               // Name (strictly to ease debugging)
@@ -2289,6 +2430,13 @@ struct ImFontAtlasCustomRect
     bool IsPacked() const           { return X != 0xFFFF; }
 };
 
+// See ImFontAtlas::TexDirtyRects
+struct ImFontAtlasTexRect
+{
+    unsigned short  X, Y;           // Position in Atlas
+    unsigned short  W, H;           // Size
+};
+
 // Flags for ImFontAtlas build
 enum ImFontAtlasFlags_
 {
@@ -2335,6 +2483,7 @@ struct ImFontAtlas
     // Building in RGBA32 format is provided for convenience and compatibility, but note that unless you manually manipulate or copy color data into
     // the texture (e.g. when using the AddCustomRect*** api), then the RGB pixels emitted will always be white (~75% of memory/bandwidth waste.
     IMGUI_API bool              Build();                    // Build pixels data. This is called automatically for you by the GetTexData*** functions.
+    IMGUI_API bool              BuildAppend();              // [BETA] Add fonts and custom rects added since the last build to the current texture, see below. Return false if they can't be: call Build() then.
     IMGUI_API void              GetTexDataAsAlpha8(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel = NULL);  // 1 byte per-pixel
     IMGUI_API void              GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel = NULL);  // 4 bytes-per-pixel
     bool                        IsBuilt() const             { return Fonts.Size > 0 && (TexPixelsAlpha8 != NULL || TexPixelsRGBA32 != NULL); }
@@ -2384,6 +2533,41 @@ struct ImFontAtlas
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
     int                         TexGlyphPadding;    // Padding between glyphs within texture in pixels. Defaults to 1. If your rendering method doesn't rely on bilinear filtering you may set this to 0.
 
+    // [BETA] Multi-threaded build: Build() splits glyph measurement and rasterization into independent work items and hands them to this function,
+    // which must call item_fn(item_arg, n) once for every n in [0..items_count), from any threads, and return once every call returned.
+    // The texture is identical to the one of a single-threaded build. The allocator set with SetAllocatorFunctions() must be thread-safe (the default one is).
+    void                        (*BuildParallelForFn)(void* user_data, int items_count, void (*item_fn)(void* item_arg, int item_n), void* item_arg);   // = NULL   // NULL: run every work item on the calling thread.
+    void*                       BuildParallelForUserData;
+
+    // [BETA] On-demand glyphs (see ImFontConfig::GlyphsOnDemand): Build() reserves DynamicPagesCount pages of DynamicPageSize x DynamicPageSize pixels
+    // at the bottom of the texture, and glyphs are rasterized into them the first time they are drawn. When every page is full, the least recently used page
+    // which wasn't used during the current frame is cleared and reused. When there is none, the glyph is drawn blank for this frame and retried on the next one.
+    // Modified texture regions are added to TexDirtyRects: the renderer back-end needs to upload them (from TexPixelsRGBA32 or TexPixelsAlpha8) then clear the list.
+    // On-demand glyphs need the font data and the CPU-side texture: calling ClearInputData() or ClearTexData() stops rasterizing them.
+    int                         DynamicPageSize;    // = 256    // Width and height of a page, in pixels. Clamped to the texture width.
+    int                         DynamicPagesCount;  // = 4      // Minimum number of pages: texture memory budget for on-demand glyphs. Build() adds pages in the space left by rounding the texture height to a power of two.
+    ImVector<ImFontAtlasTexRect> TexDirtyRects;     // Texture regions modified since the renderer back-end last uploaded them. When there are too many, a new one is merged into the one it grows the least.
+
+    // [BETA] Incremental build: fonts and custom rects added after a build can be packed and rasterized into the free space of the current texture by BuildAppend(),
+    // without moving anything already packed (UVs, TexID and texture size don't change). The regions it writes are added to TexDirtyRects, so renderer back-ends
+    // only need to upload them. Pixels of new custom rects may be written until the next upload. GetTexData*() call BuildAppend() when needed, and AddFont() doesn't
+    // clear the texture, unless the atlas can't be appended to. BuildAppend() fails (and leaves everything untouched) when the new rectangles don't fit
+    // (free space is limited to the part of the texture above the signed distance field band and on-demand glyph pages), for on-demand or signed distance
+    // field fonts, and for an atlas which wasn't built by Build() (e.g. loaded from a cache).
+
+    // [BETA] Signed distance field glyphs (see ImFontConfig::SignedDistanceField): Build() packs them in their own band of the texture, rows [TexSdfMinY, TexSdfMaxY).
+    // A texel of the band stores ((distance to the glyph outline, in texels) * SdfOnEdgeValue / SdfPadding + SdfOnEdgeValue), positive inside, clamped to [0,255].
+    // Renderer back-ends shade samples 'a' (alpha in [0,1], preferably bilinear filtered) of the font texture within those rows as coverage of the pixel:
+    //   alpha = saturate((a - SdfOnEdgeValue / 255.0f) * (255.0f * SdfPadding / SdfOnEdgeValue) / texels_per_screen_pixel + 0.5f)
+    int                         SdfPadding;         // = 4      // Distance covered by the field on each side of the outlines, in texels. Increase to draw at larger scales.
+    int                         SdfOnEdgeValue;     // = 128    // Value of the texels on the outlines [1..254]
+
+    // [BETA] Glyph instances (see ImGuiBackendFlags_RendererHasGlyphInstances): quads of all the glyphs of all the fonts, Glyphs[n] of a font being GlyphTable[font->GlyphTableOffset + n].
+    // Kept up to date by ImGui::NewFrame() when the renderer back-end supports glyph instances. The back-end uploads it again when GlyphTableVersion changes
+    // (after a build, or when on-demand glyphs are rasterized or evicted).
+    ImVector<ImDrawGlyphQuad>   GlyphTable;
+    int                         GlyphTableVersion;  // Incremented when GlyphTable is modified
+
     // [Internal]
     // NB: Access texture data via GetTexData*() calls! Which will setup a default font for you.
     unsigned char*              TexPixelsAlpha8;    // 1 component per pixel, each component is unsigned 8-bit. Total size = TexWidth * TexHeight
@@ -2392,6 +2576,10 @@ struct ImFontAtlas
     int                         TexHeight;          // Texture height calculated during Build().
     ImVec2                      TexUvScale;         // = (1.0f/TexWidth, 1.0f/TexHeight)
     ImVec2                      TexUvWhitePixel;    // Texture coordinates to a white pixel
+    int                         TexSdfMinY;         // First row of the signed distance field band
+    int                         TexSdfMaxY;         // Last row (exclusive) of the signed distance field band, == TexSdfMinY when no ImFontConfig::SignedDistanceField
+    int                         BuildGeneration;    // Incremented when the fonts or their metrics may change (AddFont, ClearTexData, ClearFonts, ImFont::BuildLookupTable). Lets caches of text sizes notice a rebuild.
+    int                         GlyphTableBuildGeneration;  // Value of BuildGeneration when GlyphTable was built, -1 if never
     ImVector<ImFont*>           Fonts;              // Hold all the fonts returned by AddFont*. Fonts[0] is the default font upon calling ImGui::NewFrame(), use ImGui::PushFont()/PopFont() to change the current font.
     ImVector<ImFontAtlasCustomRect> CustomRects;    // Rectangles for packing custom texture data into the atlas.
     ImVector<ImFontConfig>      ConfigData;         // Configuration data
@@ -2400,6 +2588,8 @@ struct ImFontAtlas
     // [Internal] Packing data
     int                         PackIdMouseCursors; // Custom texture rectangle ID for white pixel and mouse cursors
     int                         PackIdLines;        // Custom texture rectangle ID for baked anti-aliased lines
+    ImFontAtlasDynamicGlyphs*   DynamicGlyphs;      // Sources and pages of on-demand glyphs, NULL when no ImFontConfig::GlyphsOnDemand
+    ImFontAtlasPacker*          Packer;             // Skyline packer state after the last build, NULL when BuildAppend() can't be used
 
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     typedef ImFontAtlasCustomRect    CustomRect;         // OBSOLETED in 1.72+
@@ -2412,12 +2602,12 @@ struct ImFontAtlas
 struct ImFont
 {
     // Members: Hot ~20/24 bytes (for CalcTextSize)
-    ImVector<float>             IndexAdvanceX;      // 12-16 // out //            // Sparse. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this this info, and are often bottleneck in large UI).
+    ImVector<float>             IndexAdvanceX;      // 12-16 // out //            // Dense for the first 4K page (up to the highest codepoint < 4096). Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this this info, and are often bottleneck in large UI).
     float                       FallbackAdvanceX;   // 4     // out // = FallbackGlyph->AdvanceX
     float                       FontSize;           // 4     // in  //            // Height of characters/line, set during loading (don't change after loading)
 
     // Members: Hot ~28/40 bytes (for CalcTextSize + render loop)
-    ImVector<ImWchar>           IndexLookup;        // 12-16 // out //            // Sparse. Index glyphs by Unicode code-point.
+    ImVector<ImWchar>           IndexLookup;        // 12-16 // out //            // Dense for the first 4K page, same size as IndexAdvanceX. Index glyphs by Unicode code-point.
     ImVector<ImFontGlyph>       Glyphs;             // 12-16 // out //            // All glyphs.
     const ImFontGlyph*          FallbackGlyph;      // 4-8   // out // = FindGlyph(FontFallbackChar)
 
@@ -2427,18 +2617,32 @@ struct ImFont
     short                       ConfigDataCount;    // 2     // in  // ~ 1        // Number of ImFontConfig involved in creating this font. Bigger than 1 when merging multiple font sources into one ImFont.
     ImWchar                     FallbackChar;       // 2     // in  // = '?'      // Replacement character if a glyph isn't found. Only set via SetFallbackChar()
     ImWchar                     EllipsisChar;       // 2     // out // = -1       // Character used for ellipsis rendering.
+    int                         GlyphTableOffset;   // 4     // out //            // Index of Glyphs[0] within ContainerAtlas->GlyphTable (see ImGuiBackendFlags_RendererHasGlyphInstances)
     bool                        DirtyLookupTables;  // 1     // out //
     float                       Scale;              // 4     // in  // = 1.f      // Base font scale, multiplied by the per-window font scale which you can adjust with SetWindowFontScale()
     float                       Ascent, Descent;    // 4+4   // out //            // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize]
     int                         MetricsTotalSurface;// 4     // out //            // Total surface in pixels to get an idea of the font rasterization/texture cost (not exact, we approximate the cost of padding between glyphs)
-    ImU8                        Used4kPagesMap[(IM_UNICODE_CODEPOINT_MAX+1)/4096/8]; // 2 bytes if ImWchar=ImWchar16, 34 bytes if ImWchar==ImWchar32. Store 1-bit for each block of 4K codepoints that has one active glyph. This is mainly used to facilitate iterations across all used codepoints.
+    ImU8                        Used4kPagesMap[(IM_UNICODE_CODEPOINT_MAX+1)/4096/8]; // 2 bytes if ImWchar=ImWchar16, 34 bytes if ImWchar==ImWchar32. Store 1-bit for each block of 4K codepoints that has one active glyph. Also tells which 4K pages have a block in the sparse index.
+
+    // Members: Sparse index of the codepoints >= 4096. Each 4K page marked in Used4kPagesMap (except the first one) owns a block of 4096 entries,
+    // starting at IndexPagesBlock[page] * 4096. A font with a single emoji costs one block instead of a dense index up to U+1Fxxx.
+    ImVector<float>             IndexPagesAdvanceX; // 12-16 // out //            // Same as IndexAdvanceX, for the blocks
+    ImVector<ImU16>             IndexPagesLookup;   // 12-16 // out //            // Same as IndexLookup, for the blocks. 0xFFFF: no glyph
+    ImU16                       IndexPagesBlock[(IM_UNICODE_CODEPOINT_MAX+1)/4096]; // 32 bytes if ImWchar=ImWchar16, 544 bytes if ImWchar==ImWchar32. Block of each 4K page, valid when its bit is set in Used4kPagesMap.
+
+    // Members: On-demand glyphs (see ImFontConfig::GlyphsOnDemand)
+    int                         DynamicGlyphsStart; // 4     // out // = INT_MAX  // Glyphs[DynamicGlyphsStart + n] for n < DynamicGlyphsPage.Size are rasterized on demand
+    ImVector<ImU16>             DynamicGlyphsPage;  // 12-16 // out //            // Page holding the pixels of each on-demand glyph, 0xFFFF if not rasterized, 0xFFFE if there is nothing to rasterize
+    ImVector<ImU8>              DynamicGlyphsSrc;   // 12-16 // out //            // Index of each on-demand glyph source within ImFontAtlas's on-demand sources
 
     // Methods
     IMGUI_API ImFont();
     IMGUI_API ~ImFont();
     IMGUI_API const ImFontGlyph*FindGlyph(ImWchar c) const;
     IMGUI_API const ImFontGlyph*FindGlyphNoFallback(ImWchar c) const;
-    float                       GetCharAdvance(ImWchar c) const     { return ((int)c < IndexAdvanceX.Size) ? IndexAdvanceX[(int)c] : FallbackAdvanceX; }
+    float                       GetCharAdvance(ImWchar c) const     { if ((unsigned int)c < (unsigned int)IndexAdvanceX.Size) return IndexAdvanceX.Data[c]; const int entry = FindIndexPageEntry(c); return (entry >= 0) ? IndexPagesAdvanceX.Data[entry] : FallbackAdvanceX; }
+    int                         FindIndexPageEntry(unsigned int c) const { const unsigned int page_n = c >> 12; return (page_n > 0 && page_n < IM_ARRAYSIZE(IndexPagesBlock) && (Used4kPagesMap[page_n >> 3] & (1 << (page_n & 7)))) ? (int)(IndexPagesBlock[page_n] << 12) + (int)(c & 4095) : -1; } // Entry in IndexPagesAdvanceX/IndexPagesLookup, -1 if the codepoint isn't in the sparse index
+    IMGUI_API int               GetIndexMemoryUsage() const;        // Bytes used by the dense and sparse glyph index
     bool                        IsLoaded() const                    { return ContainerAtlas != NULL; }
     const char*                 GetDebugName() const                { return ConfigData ? ConfigData->Name : "<unknown>"; }
 
@@ -2452,12 +2656,14 @@ struct ImFont
     // [Internal] Don't use!
     IMGUI_API void              BuildLookupTable();
     IMGUI_API void              ClearOutputData();
-    IMGUI_API void              GrowIndex(int new_size);
+    IMGUI_API void              GrowIndex(int new_size);            // Dense index, new_size <= 4096
+    IMGUI_API int               AddIndexPage(unsigned int page_n);  // Sparse index: add a block for 4K page 'page_n' (> 0) if it doesn't have one. Return its first entry.
     IMGUI_API void              AddGlyph(const ImFontConfig* src_cfg, ImWchar c, float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, float advance_x);
     IMGUI_API void              AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst = true); // Makes 'dst' character/glyph points to 'src' character/glyph. Currently needs to be called AFTER fonts have been built.
     IMGUI_API void              SetGlyphVisible(ImWchar c, bool visible);
     IMGUI_API void              SetFallbackChar(ImWchar c);
     IMGUI_API bool              IsGlyphRangeUnused(unsigned int c_begin, unsigned int c_last);
+    IMGUI_API const ImFontGlyph*FindGlyphOnDemand(int glyph_n) const;   // Rasterize Glyphs[glyph_n] if needed. Logically const: only the texture and the glyph coordinates change.
 };
 
 #if defined(__clang__)
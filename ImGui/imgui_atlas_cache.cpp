@@ -0,0 +1,531 @@
+// dear imgui: persistent font atlas cache
+// See imgui_atlas_cache.h for the file format.
+
+#if defined(_MSC_VER) && !defined(_CRT_SECURE_NO_WARNINGS)
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include "imgui.h"
+#include "imgui_atlas_cache.h"
+#include "imgui_internal.h"     // ImFontAtlasBuildInit
+#include <stdio.h>      // FILE
+#include <string.h>     // memcpy, memcmp
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>      // open
+#include <sys/mman.h>   // mmap
+#include <sys/stat.h>   // fstat
+#include <unistd.h>     // close
+#endif
+
+#define IMGUI_ATLAS_CACHE_FILE_MAGIC    0x41464D49      // 'IMFA'
+#define IMGUI_ATLAS_CACHE_VERSION       3
+#define IMGUI_ATLAS_CACHE_BOM           0x01020304
+#define IMGUI_ATLAS_CACHE_ALIGN(_SIZE)  (((_SIZE) + 7) & ~(size_t)7)
+
+struct ImFontAtlasCacheFileHeader
+{
+    ImU32   Magic;
+    ImU32   Version;
+    ImU32   ByteOrderMark;
+    ImU16   SizeOfFontGlyph;
+    ImU16   SizeOfWchar;
+    ImU32   KeySize;
+    ImU32   FileSize;
+    ImU32   Reserved;
+};
+
+struct ImFontAtlasCacheAtlasHeader
+{
+    ImS32   TexWidth;
+    ImS32   TexHeight;
+    ImS32   TexSdfMinY;
+    ImS32   TexSdfMaxY;
+    float   TexUvWhitePixel[2];
+    float   TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1][4];
+    ImU32   CustomRectsCount;       // Followed by X, Y (u16 each) for every custom rect
+    ImU32   FontsCount;
+};
+
+struct ImFontAtlasCacheFontHeader
+{
+    float   FontSize;
+    float   Ascent;
+    float   Descent;
+    float   FallbackAdvanceX;
+    ImS32   MetricsTotalSurface;
+    ImS32   ConfigDataIndex;        // -1: ConfigData == NULL
+    ImS32   ConfigDataCount;
+    ImS32   FallbackGlyphIndex;     // -1: FallbackGlyph == NULL
+    ImU32   FallbackChar;
+    ImU32   EllipsisChar;
+    ImU32   GlyphsCount;
+    ImU32   IndexCount;             // IndexAdvanceX.Size == IndexLookup.Size
+    ImU32   IndexPagesCount;        // IndexPagesAdvanceX.Size == IndexPagesLookup.Size
+    ImU8    HasContainerAtlas;
+    ImU8    DirtyLookupTables;
+    ImU8    Reserved[2];            // Followed by Used4kPagesMap[], IndexPagesBlock[], Glyphs[], IndexAdvanceX[], IndexLookup[], IndexPagesAdvanceX[], IndexPagesLookup[]
+};
+
+//-----------------------------------------------------------------------------
+// Key
+//-----------------------------------------------------------------------------
+
+static void KeyAppend(ImVector<char>* key, const void* data, size_t size)
+{
+    const int offset = key->Size;
+    key->resize(key->Size + (int)size);
+    memcpy(key->Data + offset, data, size);
+}
+
+static void KeyAppendInt(ImVector<char>* key, int v)        { KeyAppend(key, &v, sizeof(v)); }
+static void KeyAppendFloat(ImVector<char>* key, float v)    { KeyAppend(key, &v, sizeof(v)); }
+
+// 64-bit hash of the font data, 8 bytes at a time. ImHashData() (CRC32, 1 byte at a time) would cost as much as building a small atlas.
+static ImU64 HashFontData(const void* data, size_t size)
+{
+    const ImU64 prime = 0x9E3779B97F4A7C15ULL;
+    ImU64 h = size * prime;
+    const unsigned char* p = (const unsigned char*)data;
+    for (; size >= 8; p += 8, size -= 8)
+    {
+        ImU64 v;
+        memcpy(&v, p, 8);
+        h = (h ^ v) * prime;
+        h ^= h >> 29;
+    }
+    for (; size > 0; p++, size--)
+        h = (h ^ *p) * prime;
+    return h ^ (h >> 32);
+}
+
+// Glyphs rasterized on demand live in the texture only while the application runs
+static bool HasGlyphsOnDemand(const ImFontAtlas* atlas)
+{
+    for (int n = 0; n < atlas->ConfigData.Size; n++)
+        if (atlas->ConfigData[n].GlyphsOnDemand)
+            return true;
+    return false;
+}
+
+static int IndexOfFont(const ImFontAtlas* atlas, const ImFont* font)
+{
+    for (int n = 0; n < atlas->Fonts.Size; n++)
+        if (atlas->Fonts[n] == font)
+            return n;
+    return -1;
+}
+
+// Serialize every input of the build. Everything which is a pointer is replaced with its content (font data is replaced with its hash) or with an index.
+static void BuildCacheKey(ImFontAtlas* atlas, ImVector<char>* key)
+{
+    key->resize(0);
+    KeyAppendInt(key, atlas->Flags);
+    KeyAppendInt(key, atlas->TexDesiredWidth);
+    KeyAppendInt(key, atlas->TexGlyphPadding);
+    KeyAppendInt(key, atlas->SdfPadding);
+    KeyAppendInt(key, atlas->SdfOnEdgeValue);
+    KeyAppendInt(key, atlas->Fonts.Size);
+    KeyAppendInt(key, atlas->ConfigData.Size);
+    KeyAppendInt(key, atlas->CustomRects.Size);
+    for (int n = 0; n < atlas->ConfigData.Size; n++)
+    {
+        const ImFontConfig& cfg = atlas->ConfigData[n];
+        KeyAppendInt(key, cfg.FontDataSize);
+        const ImU64 font_data_hash = HashFontData(cfg.FontData, (size_t)cfg.FontDataSize);
+        KeyAppend(key, &font_data_hash, sizeof(font_data_hash));
+        KeyAppendInt(key, cfg.FontNo);
+        KeyAppendFloat(key, cfg.SizePixels);
+        KeyAppendInt(key, cfg.OversampleH);
+        KeyAppendInt(key, cfg.OversampleV);
+        KeyAppendInt(key, cfg.PixelSnapH ? 1 : 0);
+        KeyAppendFloat(key, cfg.GlyphExtraSpacing.x);
+        KeyAppendFloat(key, cfg.GlyphExtraSpacing.y);
+        KeyAppendFloat(key, cfg.GlyphOffset.x);
+        KeyAppendFloat(key, cfg.GlyphOffset.y);
+        KeyAppendFloat(key, cfg.GlyphMinAdvanceX);
+        KeyAppendFloat(key, cfg.GlyphMaxAdvanceX);
+        KeyAppendInt(key, cfg.MergeMode ? 1 : 0);
+        KeyAppendInt(key, (int)cfg.RasterizerFlags);
+        KeyAppendFloat(key, cfg.RasterizerMultiply);
+        KeyAppendInt(key, (int)cfg.EllipsisChar);
+        KeyAppendInt(key, cfg.SignedDistanceField ? 1 : 0);
+        KeyAppendInt(key, IndexOfFont(atlas, cfg.DstFont));
+
+        // Same default as the builder
+        const ImWchar* ranges = cfg.GlyphRanges ? cfg.GlyphRanges : atlas->GetGlyphRangesDefault();
+        int ranges_count = 0;
+        while (ranges[ranges_count] && ranges[ranges_count + 1])
+            ranges_count += 2;
+        KeyAppendInt(key, ranges_count);
+        KeyAppend(key, ranges, ranges_count * sizeof(ImWchar));
+    }
+    for (int n = 0; n < atlas->Fonts.Size; n++)
+        KeyAppendInt(key, (int)atlas->Fonts[n]->FallbackChar);
+    for (int n = 0; n < atlas->CustomRects.Size; n++)
+    {
+        const ImFontAtlasCustomRect& r = atlas->CustomRects[n];
+        KeyAppendInt(key, r.Width);
+        KeyAppendInt(key, r.Height);
+        KeyAppendInt(key, (int)r.GlyphID);
+        KeyAppendFloat(key, r.GlyphAdvanceX);
+        KeyAppendFloat(key, r.GlyphOffset.x);
+        KeyAppendFloat(key, r.GlyphOffset.y);
+        KeyAppendInt(key, IndexOfFont(atlas, r.Font));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Save
+//-----------------------------------------------------------------------------
+
+static void WritePadding(FILE* f, size_t size)
+{
+    static const unsigned char zeroes[8] = {};
+    if (size != IMGUI_ATLAS_CACHE_ALIGN(size))
+        fwrite(zeroes, 1, IMGUI_ATLAS_CACHE_ALIGN(size) - size, f);
+}
+
+bool ImFontAtlasCache_Save(ImFontAtlas* atlas, const char* filename)
+{
+    if (!atlas->IsBuilt() || atlas->TexPixelsAlpha8 == NULL || HasGlyphsOnDemand(atlas))
+        return false;
+    ImVector<char> key;
+    BuildCacheKey(atlas, &key);
+
+    // Compute the file size first, the reader rejects files whose size doesn't match (e.g. truncated by a crash while saving)
+    size_t file_size = sizeof(ImFontAtlasCacheFileHeader) + IMGUI_ATLAS_CACHE_ALIGN(key.Size);
+    file_size += sizeof(ImFontAtlasCacheAtlasHeader) + IMGUI_ATLAS_CACHE_ALIGN(atlas->CustomRects.Size * sizeof(ImU16) * 2);
+    for (int n = 0; n < atlas->Fonts.Size; n++)
+    {
+        const ImFont* font = atlas->Fonts[n];
+        file_size += sizeof(ImFontAtlasCacheFontHeader) + IMGUI_ATLAS_CACHE_ALIGN(sizeof(font->Used4kPagesMap)) + IMGUI_ATLAS_CACHE_ALIGN(sizeof(font->IndexPagesBlock));
+        file_size += IMGUI_ATLAS_CACHE_ALIGN(font->Glyphs.Size * sizeof(ImFontGlyph));
+        file_size += IMGUI_ATLAS_CACHE_ALIGN(font->IndexAdvanceX.Size * sizeof(float));
+        file_size += IMGUI_ATLAS_CACHE_ALIGN(font->IndexLookup.Size * sizeof(ImWchar));
+        file_size += IMGUI_ATLAS_CACHE_ALIGN(font->IndexPagesAdvanceX.Size * sizeof(float));
+        file_size += IMGUI_ATLAS_CACHE_ALIGN(font->IndexPagesLookup.Size * sizeof(ImU16));
+    }
+    file_size += IMGUI_ATLAS_CACHE_ALIGN((size_t)atlas->TexWidth * atlas->TexHeight);
+    if (file_size > 0xFFFFFFFF)
+        return false;
+
+    FILE* f = fopen(filename, "wb");
+    if (f == NULL)
+        return false;
+
+    ImFontAtlasCacheFileHeader header;
+    memset(&header, 0, sizeof(header));
+    header.Magic = IMGUI_ATLAS_CACHE_FILE_MAGIC;
+    header.Version = IMGUI_ATLAS_CACHE_VERSION;
+    header.ByteOrderMark = IMGUI_ATLAS_CACHE_BOM;
+    header.SizeOfFontGlyph = (ImU16)sizeof(ImFontGlyph);
+    header.SizeOfWchar = (ImU16)sizeof(ImWchar);
+    header.KeySize = (ImU32)key.Size;
+    header.FileSize = (ImU32)file_size;
+    fwrite(&header, sizeof(header), 1, f);
+    fwrite(key.Data, 1, (size_t)key.Size, f);
+    WritePadding(f, (size_t)key.Size);
+
+    ImFontAtlasCacheAtlasHeader atlas_header;
+    memset(&atlas_header, 0, sizeof(atlas_header));
+    atlas_header.TexWidth = atlas->TexWidth;
+    atlas_header.TexHeight = atlas->TexHeight;
+    atlas_header.TexSdfMinY = atlas->TexSdfMinY;
+    atlas_header.TexSdfMaxY = atlas->TexSdfMaxY;
+    atlas_header.TexUvWhitePixel[0] = atlas->TexUvWhitePixel.x;
+    atlas_header.TexUvWhitePixel[1] = atlas->TexUvWhitePixel.y;
+    for (int n = 0; n < IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1; n++)
+    {
+        atlas_header.TexUvLines[n][0] = atlas->TexUvLines[n].x;
+        atlas_header.TexUvLines[n][1] = atlas->TexUvLines[n].y;
+        atlas_header.TexUvLines[n][2] = atlas->TexUvLines[n].z;
+        atlas_header.TexUvLines[n][3] = atlas->TexUvLines[n].w;
+    }
+    atlas_header.CustomRectsCount = (ImU32)atlas->CustomRects.Size;
+    atlas_header.FontsCount = (ImU32)atlas->Fonts.Size;
+    fwrite(&atlas_header, sizeof(atlas_header), 1, f);
+    for (int n = 0; n < atlas->CustomRects.Size; n++)
+    {
+        const ImU16 pos[2] = { atlas->CustomRects[n].X, atlas->CustomRects[n].Y };
+        fwrite(pos, sizeof(pos), 1, f);
+    }
+    WritePadding(f, atlas->CustomRects.Size * sizeof(ImU16) * 2);
+
+    for (int n = 0; n < atlas->Fonts.Size; n++)
+    {
+        const ImFont* font = atlas->Fonts[n];
+        ImFontAtlasCacheFontHeader font_header;
+        memset(&font_header, 0, sizeof(font_header));
+        font_header.FontSize = font->FontSize;
+        font_header.Ascent = font->Ascent;
+        font_header.Descent = font->Descent;
+        font_header.FallbackAdvanceX = font->FallbackAdvanceX;
+        font_header.MetricsTotalSurface = font->MetricsTotalSurface;
+        font_header.ConfigDataIndex = font->ConfigData ? (ImS32)(font->ConfigData - atlas->ConfigData.Data) : -1;
+        font_header.ConfigDataCount = font->ConfigDataCount;
+        font_header.FallbackGlyphIndex = font->FallbackGlyph ? (ImS32)(font->FallbackGlyph - font->Glyphs.Data) : -1;
+        font_header.FallbackChar = font->FallbackChar;
+        font_header.EllipsisChar = font->EllipsisChar;
+        font_header.GlyphsCount = (ImU32)font->Glyphs.Size;
+        font_header.IndexCount = (ImU32)font->IndexLookup.Size;
+        font_header.IndexPagesCount = (ImU32)font->IndexPagesLookup.Size;
+        font_header.HasContainerAtlas = (font->ContainerAtlas == atlas) ? 1 : 0;
+        font_header.DirtyLookupTables = font->DirtyLookupTables ? 1 : 0;
+        IM_ASSERT(font->IndexAdvanceX.Size == font->IndexLookup.Size && font->IndexPagesAdvanceX.Size == font->IndexPagesLookup.Size);
+        IM_ASSERT(font_header.ConfigDataIndex < atlas->ConfigData.Size);
+        fwrite(&font_header, sizeof(font_header), 1, f);
+        fwrite(font->Used4kPagesMap, sizeof(font->Used4kPagesMap), 1, f);
+        WritePadding(f, sizeof(font->Used4kPagesMap));
+        fwrite(font->IndexPagesBlock, sizeof(font->IndexPagesBlock), 1, f);
+        WritePadding(f, sizeof(font->IndexPagesBlock));
+        fwrite(font->Glyphs.Data, sizeof(ImFontGlyph), (size_t)font->Glyphs.Size, f);
+        WritePadding(f, font->Glyphs.Size * sizeof(ImFontGlyph));
+        fwrite(font->IndexAdvanceX.Data, sizeof(float), (size_t)font->IndexAdvanceX.Size, f);
+        WritePadding(f, font->IndexAdvanceX.Size * sizeof(float));
+        fwrite(font->IndexLookup.Data, sizeof(ImWchar), (size_t)font->IndexLookup.Size, f);
+        WritePadding(f, font->IndexLookup.Size * sizeof(ImWchar));
+        fwrite(font->IndexPagesAdvanceX.Data, sizeof(float), (size_t)font->IndexPagesAdvanceX.Size, f);
+        WritePadding(f, font->IndexPagesAdvanceX.Size * sizeof(float));
+        fwrite(font->IndexPagesLookup.Data, sizeof(ImU16), (size_t)font->IndexPagesLookup.Size, f);
+        WritePadding(f, font->IndexPagesLookup.Size * sizeof(ImU16));
+    }
+
+    fwrite(atlas->TexPixelsAlpha8, 1, (size_t)atlas->TexWidth * atlas->TexHeight, f);
+    WritePadding(f, (size_t)atlas->TexWidth * atlas->TexHeight);
+    const bool ok = (ferror(f) == 0) && ((size_t)ftell(f) == file_size);
+    fclose(f);
+    return ok;
+}
+
+//-----------------------------------------------------------------------------
+// Load
+//-----------------------------------------------------------------------------
+
+// Read-only file mapping
+struct ImFontAtlasCacheMapping
+{
+    const unsigned char*    Data;
+    size_t                  Size;
+    void*                   Handle;     // Platform specific
+
+    ImFontAtlasCacheMapping()   { Data = NULL; Size = 0; Handle = NULL; }
+    ~ImFontAtlasCacheMapping()  { Unmap(); }
+
+    bool Map(const char* filename)
+    {
+#if defined(_WIN32)
+        HANDLE file = ::CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+        LARGE_INTEGER file_size;
+        HANDLE mapping = NULL;
+        if (::GetFileSizeEx(file, &file_size) && file_size.QuadPart >= (LONGLONG)sizeof(ImFontAtlasCacheFileHeader))
+            mapping = ::CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        ::CloseHandle(file);
+        if (mapping == NULL)
+            return false;
+        Data = (const unsigned char*)::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (Data == NULL)
+        {
+            ::CloseHandle(mapping);
+            return false;
+        }
+        Size = (size_t)file_size.QuadPart;
+        Handle = (void*)mapping;
+#else
+        int fd = open(filename, O_RDONLY);
+        if (fd < 0)
+            return false;
+        struct stat st;
+        void* data = MAP_FAILED;
+        if (fstat(fd, &st) == 0 && st.st_size >= (off_t)sizeof(ImFontAtlasCacheFileHeader))
+            data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (data == MAP_FAILED)
+            return false;
+        Data = (const unsigned char*)data;
+        Size = (size_t)st.st_size;
+#endif
+        return true;
+    }
+
+    void Unmap()
+    {
+        if (Data != NULL)
+        {
+#if defined(_WIN32)
+            ::UnmapViewOfFile(Data);
+            ::CloseHandle((HANDLE)Handle);
+#else
+            munmap((void*)Data, Size);
+#endif
+        }
+        Data = NULL;
+        Size = 0;
+        Handle = NULL;
+    }
+};
+
+// Bounds-checked sequential reads from the mapping. Sections are aligned to 8 bytes.
+struct ImFontAtlasCacheReader
+{
+    const unsigned char*    Cursor;
+    const unsigned char*    End;
+
+    const void* Read(size_t size)
+    {
+        const size_t aligned_size = IMGUI_ATLAS_CACHE_ALIGN(size);
+        if ((size_t)(End - Cursor) < aligned_size)
+            return NULL;
+        const void* data = Cursor;
+        Cursor += aligned_size;
+        return data;
+    }
+};
+
+bool ImFontAtlasCache_Load(ImFontAtlas* atlas, const char* filename)
+{
+    IM_ASSERT(!atlas->Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    IM_ASSERT(atlas->ConfigData.Size > 0);
+    if (HasGlyphsOnDemand(atlas))
+        return false;
+    ImFontAtlasCacheMapping mapping;
+    if (!mapping.Map(filename))
+        return false;
+
+    ImFontAtlasCacheFileHeader header;
+    memcpy(&header, mapping.Data, sizeof(header));
+    if (header.Magic != IMGUI_ATLAS_CACHE_FILE_MAGIC || header.Version != IMGUI_ATLAS_CACHE_VERSION || header.ByteOrderMark != IMGUI_ATLAS_CACHE_BOM ||
+        header.SizeOfFontGlyph != sizeof(ImFontGlyph) || header.SizeOfWchar != sizeof(ImWchar) || header.FileSize != mapping.Size)
+        return false;
+
+    // Register the default custom rects as Build() would, they are part of the key
+    ImFontAtlasBuildInit(atlas);
+    ImVector<char> key;
+    BuildCacheKey(atlas, &key);
+    ImFontAtlasCacheReader reader;
+    reader.Cursor = mapping.Data + sizeof(header);
+    reader.End = mapping.Data + mapping.Size;
+    const void* file_key = reader.Read(header.KeySize);
+    if (file_key == NULL || header.KeySize != (ImU32)key.Size || memcmp(file_key, key.Data, (size_t)key.Size) != 0)
+        return false;
+
+    // Validate every section before modifying the atlas
+    const ImFontAtlasCacheAtlasHeader* atlas_header = (const ImFontAtlasCacheAtlasHeader*)reader.Read(sizeof(ImFontAtlasCacheAtlasHeader));
+    if (atlas_header == NULL || atlas_header->CustomRectsCount != (ImU32)atlas->CustomRects.Size || atlas_header->FontsCount != (ImU32)atlas->Fonts.Size || atlas_header->TexWidth <= 0 || atlas_header->TexHeight <= 0)
+        return false;
+    const ImU16* custom_rects_pos = (const ImU16*)reader.Read(atlas->CustomRects.Size * sizeof(ImU16) * 2);
+    if (custom_rects_pos == NULL)
+        return false;
+    const unsigned char* fonts_start = reader.Cursor;
+    for (int n = 0; n < atlas->Fonts.Size; n++)
+    {
+        const ImFontAtlasCacheFontHeader* font_header = (const ImFontAtlasCacheFontHeader*)reader.Read(sizeof(ImFontAtlasCacheFontHeader));
+        if (font_header == NULL || font_header->GlyphsCount >= 0xFFFF || font_header->FallbackGlyphIndex < -1 || font_header->FallbackGlyphIndex >= (ImS32)font_header->GlyphsCount)
+            return false;
+        if (font_header->ConfigDataIndex == -1 ? font_header->ConfigDataCount != 0 : (font_header->ConfigDataIndex < 0 || font_header->ConfigDataCount < 0 || font_header->ConfigDataCount > atlas->ConfigData.Size - font_header->ConfigDataIndex))
+            return false;
+        if (font_header->IndexCount > 4096 || (font_header->IndexPagesCount & 4095) != 0)
+            return false;
+        const ImU8* used_4k_pages_map = (const ImU8*)reader.Read(sizeof(atlas->Fonts[n]->Used4kPagesMap));
+        const ImU16* index_pages_block = (const ImU16*)reader.Read(sizeof(atlas->Fonts[n]->IndexPagesBlock));
+        if (!used_4k_pages_map || !index_pages_block || !reader.Read(font_header->GlyphsCount * sizeof(ImFontGlyph)) || !reader.Read(font_header->IndexCount * sizeof(float)))
+            return false;
+        const ImWchar* index_lookup = (const ImWchar*)reader.Read(font_header->IndexCount * sizeof(ImWchar));
+        if (!index_lookup || !reader.Read(font_header->IndexPagesCount * sizeof(float)))
+            return false;
+        const ImU16* index_pages_lookup = (const ImU16*)reader.Read(font_header->IndexPagesCount * sizeof(ImU16));
+        if (!index_pages_lookup)
+            return false;
+
+        // Lookup tables must only reference glyphs of the font, and used pages must have their block of IndexPagesLookup (see ImFont::FindIndexPageEntry)
+        for (ImU32 i = 0; i < font_header->IndexCount; i++)
+            if (index_lookup[i] != (ImWchar)-1 && index_lookup[i] >= font_header->GlyphsCount)
+                return false;
+        for (ImU32 i = 0; i < font_header->IndexPagesCount; i++)
+            if (index_pages_lookup[i] != 0xFFFF && index_pages_lookup[i] >= font_header->GlyphsCount)
+                return false;
+        for (int page_n = 1; page_n < IM_ARRAYSIZE(atlas->Fonts[n]->IndexPagesBlock); page_n++)
+            if ((used_4k_pages_map[page_n >> 3] & (1 << (page_n & 7))) && ((ImU32)index_pages_block[page_n] + 1) * 4096 > font_header->IndexPagesCount)
+                return false;
+    }
+    const unsigned char* tex_pixels = (const unsigned char*)reader.Read((size_t)atlas_header->TexWidth * atlas_header->TexHeight);
+    if (tex_pixels == NULL)
+        return false;
+
+    // Atlas
+    atlas->ClearTexData();
+    atlas->TexID = (ImTextureID)NULL;
+    atlas->TexWidth = atlas_header->TexWidth;
+    atlas->TexHeight = atlas_header->TexHeight;
+    atlas->TexSdfMinY = atlas_header->TexSdfMinY;
+    atlas->TexSdfMaxY = atlas_header->TexSdfMaxY;
+    atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
+    atlas->TexUvWhitePixel = ImVec2(atlas_header->TexUvWhitePixel[0], atlas_header->TexUvWhitePixel[1]);
+    for (int n = 0; n < IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1; n++)
+        atlas->TexUvLines[n] = ImVec4(atlas_header->TexUvLines[n][0], atlas_header->TexUvLines[n][1], atlas_header->TexUvLines[n][2], atlas_header->TexUvLines[n][3]);
+    for (int n = 0; n < atlas->CustomRects.Size; n++)
+    {
+        atlas->CustomRects[n].X = custom_rects_pos[n * 2 + 0];
+        atlas->CustomRects[n].Y = custom_rects_pos[n * 2 + 1];
+    }
+    atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC((size_t)atlas->TexWidth * atlas->TexHeight);
+    memcpy(atlas->TexPixelsAlpha8, tex_pixels, (size_t)atlas->TexWidth * atlas->TexHeight);
+
+    // Fonts
+    reader.Cursor = fonts_start;
+    for (int n = 0; n < atlas->Fonts.Size; n++)
+    {
+        ImFont* font = atlas->Fonts[n];
+        const ImFontAtlasCacheFontHeader* font_header = (const ImFontAtlasCacheFontHeader*)reader.Read(sizeof(ImFontAtlasCacheFontHeader));
+        const void* used_4k_pages_map = reader.Read(sizeof(font->Used4kPagesMap));
+        const void* index_pages_block = reader.Read(sizeof(font->IndexPagesBlock));
+        const void* glyphs = reader.Read(font_header->GlyphsCount * sizeof(ImFontGlyph));
+        const void* index_advance_x = reader.Read(font_header->IndexCount * sizeof(float));
+        const void* index_lookup = reader.Read(font_header->IndexCount * sizeof(ImWchar));
+        const void* index_pages_advance_x = reader.Read(font_header->IndexPagesCount * sizeof(float));
+        const void* index_pages_lookup = reader.Read(font_header->IndexPagesCount * sizeof(ImU16));
+
+        font->ClearOutputData();
+        font->FontSize = font_header->FontSize;
+        font->Ascent = font_header->Ascent;
+        font->Descent = font_header->Descent;
+        font->FallbackAdvanceX = font_header->FallbackAdvanceX;
+        font->MetricsTotalSurface = font_header->MetricsTotalSurface;
+        font->ConfigData = (font_header->ConfigDataIndex >= 0) ? &atlas->ConfigData[font_header->ConfigDataIndex] : NULL;
+        font->ConfigDataCount = (short)font_header->ConfigDataCount;
+        font->ContainerAtlas = font_header->HasContainerAtlas ? atlas : NULL;
+        font->FallbackChar = (ImWchar)font_header->FallbackChar;
+        font->EllipsisChar = (ImWchar)font_header->EllipsisChar;
+        font->DirtyLookupTables = font_header->DirtyLookupTables != 0;
+        memcpy(font->Used4kPagesMap, used_4k_pages_map, sizeof(font->Used4kPagesMap));
+        memcpy(font->IndexPagesBlock, index_pages_block, sizeof(font->IndexPagesBlock));
+        font->Glyphs.resize((int)font_header->GlyphsCount);
+        memcpy(font->Glyphs.Data, glyphs, font_header->GlyphsCount * sizeof(ImFontGlyph));
+        font->IndexAdvanceX.resize((int)font_header->IndexCount);
+        memcpy(font->IndexAdvanceX.Data, index_advance_x, font_header->IndexCount * sizeof(float));
+        font->IndexLookup.resize((int)font_header->IndexCount);
+        memcpy(font->IndexLookup.Data, index_lookup, font_header->IndexCount * sizeof(ImWchar));
+        font->IndexPagesAdvanceX.resize((int)font_header->IndexPagesCount);
+        memcpy(font->IndexPagesAdvanceX.Data, index_pages_advance_x, font_header->IndexPagesCount * sizeof(float));
+        font->IndexPagesLookup.resize((int)font_header->IndexPagesCount);
+        memcpy(font->IndexPagesLookup.Data, index_pages_lookup, font_header->IndexPagesCount * sizeof(ImU16));
+        font->FallbackGlyph = (font_header->FallbackGlyphIndex >= 0) ? &font->Glyphs[font_header->FallbackGlyphIndex] : NULL;
+    }
+    return true;
+}
+
+bool ImFontAtlasCache_LoadOrBuild(ImFontAtlas* atlas, const char* filename)
+{
+    if (ImFontAtlasCache_Load(atlas, filename))
+        return true;
+    if (!atlas->Build())
+        return false;
+    ImFontAtlasCache_Save(atlas, filename);
+    return true;
+}
@@ -0,0 +1,28 @@
+// dear imgui: persistent font atlas cache
+// Save the output of ImFontAtlas::Build() to a file, and restore it on later launches without parsing or rasterizing the fonts.
+// The cache is keyed by every build input: font data (size + 64-bit hash), ImFontConfig fields, glyph ranges, atlas flags/settings and custom rects.
+// A cache file built from different inputs, by a different version of this code, or with a different ImWchar is ignored.
+// Atlases with ImFontConfig::GlyphsOnDemand sources are never cached (LoadOrBuild() always builds them): they are cheap to build.
+
+// Usage:
+//   io.Fonts->AddFontFromFileTTF("font.ttf", 16.0f, &config);  // Font data is still loaded: the cache key includes a hash of it
+//   ImFontAtlasCache_LoadOrBuild(io.Fonts, "imgui_atlas.cache");
+//   [initialize the renderer back-end, which calls GetTexDataAsRGBA32() and finds the atlas already built]
+
+// File format (version 3, native endianness, all sections aligned to 8 bytes):
+//   Header: magic 'IMFA', u32 version, u32 byte order mark (0x01020304), u16 sizeof(ImFontGlyph), u16 sizeof(ImWchar), u32 key size, u32 file size, u32 reserved
+//   Key:    opaque blob compared byte for byte with the key computed from the atlas being loaded
+//   Atlas:  texture size, signed distance field rows, white pixel and baked lines UVs, custom rects count and positions, fonts count
+//   Fonts:  for each font: metrics, fallback/ellipsis data, Used4kPagesMap, IndexPagesBlock, then Glyphs[], IndexAdvanceX[], IndexLookup[], IndexPagesAdvanceX[], IndexPagesLookup[]
+//   Alpha8 texture (TexWidth * TexHeight bytes)
+// Load maps the file in memory and copies the tables and texture out of the mapping (the atlas owns and frees its buffers).
+
+#pragma once
+#include "imgui.h"
+
+// Restore a previously saved build. The atlas must have its fonts added and not be built yet. Return false if the file is missing or stale.
+IMGUI_API bool  ImFontAtlasCache_Load(ImFontAtlas* atlas, const char* filename);
+// Save the output of a built atlas. Return false if the atlas isn't built or has no alpha8 texture (e.g. after ClearTexData()).
+IMGUI_API bool  ImFontAtlasCache_Save(ImFontAtlas* atlas, const char* filename);
+// Load, or Build() and Save() when the cache is missing or stale. Return false if the build failed.
+IMGUI_API bool  ImFontAtlasCache_LoadOrBuild(ImFontAtlas* atlas, const char* filename);
@@ -0,0 +1,355 @@
+// dear imgui: ImDrawData capture and replay
+// See imgui_capture.h for the file format.
+
+#if defined(_MSC_VER) && !defined(_CRT_SECURE_NO_WARNINGS)
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include "imgui.h"
+#include "imgui_capture.h"
+#include <string.h>     // memcpy, memset
+#include <stdint.h>     // intptr_t
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>      // open
+#include <sys/mman.h>   // mmap
+#include <sys/stat.h>   // fstat
+#include <unistd.h>     // close
+#endif
+
+#define IMGUI_CAPTURE_FILE_MAGIC    0x43444D49      // 'IMDC'
+#define IMGUI_CAPTURE_FRAME_MAGIC   0x454D5246      // 'FRME'
+#define IMGUI_CAPTURE_VERSION       2
+#define IMGUI_CAPTURE_BOM           0x01020304
+#define IMGUI_CAPTURE_ALIGN(_SIZE)  (((_SIZE) + 7) & ~(size_t)7)
+
+struct ImGuiCaptureFileHeader
+{
+    ImU32   Magic;
+    ImU32   Version;
+    ImU32   ByteOrderMark;
+    ImU16   SizeOfDrawVert;
+    ImU16   SizeOfDrawIdx;
+    ImU32   Reserved;
+};
+
+struct ImGuiCaptureFrameHeader
+{
+    ImU32   Magic;
+    ImU32   FrameSize;
+    ImU32   CmdListsCount;
+    ImU32   Reserved;
+    float   DisplayPos[2];
+    float   DisplaySize[2];
+    float   FramebufferScale[2];
+};
+
+struct ImGuiCaptureListHeader
+{
+    ImU32   CmdCount;
+    ImU32   VtxCount;
+    ImU32   IdxCount;
+    ImU32   Flags;
+    ImU32   GlyphCount;
+    ImU32   Reserved;
+};
+
+static void WritePadding(FILE* f, size_t size)
+{
+    static const unsigned char zeroes[8] = {};
+    if (size != IMGUI_CAPTURE_ALIGN(size))
+        fwrite(zeroes, 1, IMGUI_CAPTURE_ALIGN(size) - size, f);
+}
+
+//-----------------------------------------------------------------------------
+// ImGuiCaptureWriter
+//-----------------------------------------------------------------------------
+
+bool ImGuiCaptureWriter::Open(const char* filename)
+{
+    Close();
+    File = fopen(filename, "wb");
+    if (File == NULL)
+        return false;
+    FramesCount = 0;
+
+    ImGuiCaptureFileHeader header;
+    memset(&header, 0, sizeof(header));
+    header.Magic = IMGUI_CAPTURE_FILE_MAGIC;
+    header.Version = IMGUI_CAPTURE_VERSION;
+    header.ByteOrderMark = IMGUI_CAPTURE_BOM;
+    header.SizeOfDrawVert = (ImU16)sizeof(ImDrawVert);
+    header.SizeOfDrawIdx = (ImU16)sizeof(ImDrawIdx);
+    return fwrite(&header, sizeof(header), 1, File) == 1;
+}
+
+bool ImGuiCaptureWriter::WriteFrame(const ImDrawData* draw_data)
+{
+    IM_ASSERT(File != NULL && "Missing call to Open()");
+    if (File == NULL || draw_data == NULL || !draw_data->Valid)
+        return false;
+
+    // Compute the frame size first so the reader can skip frames without parsing them
+    size_t frame_size = sizeof(ImGuiCaptureFrameHeader);
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        frame_size += sizeof(ImGuiCaptureListHeader);
+        frame_size += cmd_list->CmdBuffer.Size * sizeof(ImGuiCaptureCmd);
+        frame_size += IMGUI_CAPTURE_ALIGN(cmd_list->VtxBuffer.Size * sizeof(ImDrawVert));
+        frame_size += IMGUI_CAPTURE_ALIGN(cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx));
+        frame_size += IMGUI_CAPTURE_ALIGN(cmd_list->GlyphBuffer.Size * sizeof(ImDrawGlyph));
+    }
+    if (frame_size > 0xFFFFFFFF)
+        return false;
+
+    ImGuiCaptureFrameHeader frame_header;
+    memset(&frame_header, 0, sizeof(frame_header));
+    frame_header.Magic = IMGUI_CAPTURE_FRAME_MAGIC;
+    frame_header.FrameSize = (ImU32)frame_size;
+    frame_header.CmdListsCount = (ImU32)draw_data->CmdListsCount;
+    frame_header.DisplayPos[0] = draw_data->DisplayPos.x;
+    frame_header.DisplayPos[1] = draw_data->DisplayPos.y;
+    frame_header.DisplaySize[0] = draw_data->DisplaySize.x;
+    frame_header.DisplaySize[1] = draw_data->DisplaySize.y;
+    frame_header.FramebufferScale[0] = draw_data->FramebufferScale.x;
+    frame_header.FramebufferScale[1] = draw_data->FramebufferScale.y;
+    fwrite(&frame_header, sizeof(frame_header), 1, File);
+
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        ImGuiCaptureListHeader list_header;
+        memset(&list_header, 0, sizeof(list_header));
+        list_header.CmdCount = (ImU32)cmd_list->CmdBuffer.Size;
+        list_header.VtxCount = (ImU32)cmd_list->VtxBuffer.Size;
+        list_header.IdxCount = (ImU32)cmd_list->IdxBuffer.Size;
+        list_header.Flags = (ImU32)cmd_list->Flags;
+        list_header.GlyphCount = (ImU32)cmd_list->GlyphBuffer.Size;
+        fwrite(&list_header, sizeof(list_header), 1, File);
+
+        TempCmds.resize(cmd_list->CmdBuffer.Size);
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* src = &cmd_list->CmdBuffer[cmd_i];
+            ImGuiCaptureCmd* dst = &TempCmds[cmd_i];
+            dst->ClipRect[0] = src->ClipRect.x;
+            dst->ClipRect[1] = src->ClipRect.y;
+            dst->ClipRect[2] = src->ClipRect.z;
+            dst->ClipRect[3] = src->ClipRect.w;
+            dst->TextureId = (ImU64)(intptr_t)src->TextureId;
+            dst->VtxOffset = src->VtxOffset;
+            dst->IdxOffset = src->IdxOffset;
+            dst->ElemCount = src->ElemCount;
+            dst->GlyphOffset = src->GlyphOffset;
+            dst->GlyphCount = src->GlyphCount;
+            dst->CallbackType = (src->UserCallback == NULL) ? 0 : (src->UserCallback == ImDrawCallback_ResetRenderState) ? 1 : 2;
+        }
+        fwrite(TempCmds.Data, sizeof(ImGuiCaptureCmd), (size_t)TempCmds.Size, File);
+        fwrite(cmd_list->VtxBuffer.Data, sizeof(ImDrawVert), (size_t)cmd_list->VtxBuffer.Size, File);
+        WritePadding(File, cmd_list->VtxBuffer.Size * sizeof(ImDrawVert));
+        fwrite(cmd_list->IdxBuffer.Data, sizeof(ImDrawIdx), (size_t)cmd_list->IdxBuffer.Size, File);
+        WritePadding(File, cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx));
+        fwrite(cmd_list->GlyphBuffer.Data, sizeof(ImDrawGlyph), (size_t)cmd_list->GlyphBuffer.Size, File);
+        WritePadding(File, cmd_list->GlyphBuffer.Size * sizeof(ImDrawGlyph));
+    }
+    FramesCount++;
+    return ferror(File) == 0;
+}
+
+void ImGuiCaptureWriter::Close()
+{
+    if (File != NULL)
+        fclose(File);
+    File = NULL;
+    TempCmds.clear();
+}
+
+//-----------------------------------------------------------------------------
+// ImGuiCaptureReader
+//-----------------------------------------------------------------------------
+
+bool ImGuiCaptureReader::Open(const char* filename)
+{
+    Close();
+
+#if defined(_WIN32)
+    HANDLE file = ::CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+    LARGE_INTEGER file_size;
+    HANDLE mapping = NULL;
+    if (::GetFileSizeEx(file, &file_size) && file_size.QuadPart >= (LONGLONG)sizeof(ImGuiCaptureFileHeader))
+        mapping = ::CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    ::CloseHandle(file);
+    if (mapping == NULL)
+        return false;
+    MappedData = (const unsigned char*)::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (MappedData == NULL)
+    {
+        ::CloseHandle(mapping);
+        return false;
+    }
+    MappedSize = (size_t)file_size.QuadPart;
+    MappingHandle = (void*)mapping;
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    void* data = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size >= (off_t)sizeof(ImGuiCaptureFileHeader))
+        data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return false;
+    MappedData = (const unsigned char*)data;
+    MappedSize = (size_t)st.st_size;
+#endif
+
+    // Validate header
+    ImGuiCaptureFileHeader header;
+    memcpy(&header, MappedData, sizeof(header));
+    if (header.Magic != IMGUI_CAPTURE_FILE_MAGIC || header.Version != IMGUI_CAPTURE_VERSION || header.ByteOrderMark != IMGUI_CAPTURE_BOM ||
+        header.SizeOfDrawVert != sizeof(ImDrawVert) || header.SizeOfDrawIdx != sizeof(ImDrawIdx))
+    {
+        Close();
+        return false;
+    }
+
+    // Index frames. A truncated trailing frame (e.g. the recording process crashed) is ignored.
+    size_t offset = sizeof(ImGuiCaptureFileHeader);
+    while (offset + sizeof(ImGuiCaptureFrameHeader) <= MappedSize)
+    {
+        const ImGuiCaptureFrameHeader* frame_header = (const ImGuiCaptureFrameHeader*)(MappedData + offset);
+        if (frame_header->Magic != IMGUI_CAPTURE_FRAME_MAGIC || frame_header->FrameSize < sizeof(ImGuiCaptureFrameHeader) || offset + frame_header->FrameSize > MappedSize)
+            break;
+        FrameOffsets.push_back(offset);
+        offset += frame_header->FrameSize;
+    }
+    return true;
+}
+
+void ImGuiCaptureReader::Close()
+{
+    // The draw lists buffers point into the mapping: detach them before the destructor tries to free them
+    for (int n = 0; n < DrawLists.Size; n++)
+    {
+        ImDrawList* draw_list = DrawLists[n];
+        draw_list->VtxBuffer.Data = NULL; draw_list->VtxBuffer.Size = draw_list->VtxBuffer.Capacity = 0;
+        draw_list->IdxBuffer.Data = NULL; draw_list->IdxBuffer.Size = draw_list->IdxBuffer.Capacity = 0;
+        draw_list->GlyphBuffer.Data = NULL; draw_list->GlyphBuffer.Size = draw_list->GlyphBuffer.Capacity = 0;
+        IM_DELETE(draw_list);
+    }
+    DrawLists.clear();
+    FrameOffsets.clear();
+    DrawData.Clear();
+
+    if (MappedData != NULL)
+    {
+#if defined(_WIN32)
+        ::UnmapViewOfFile(MappedData);
+        ::CloseHandle((HANDLE)MappingHandle);
+#else
+        munmap((void*)MappedData, MappedSize);
+#endif
+    }
+    MappedData = NULL;
+    MappedSize = 0;
+    MappingHandle = NULL;
+}
+
+ImDrawData* ImGuiCaptureReader::GetFrame(int frame_index)
+{
+    IM_ASSERT(frame_index >= 0 && frame_index < FrameOffsets.Size);
+    const unsigned char* frame_start = MappedData + FrameOffsets[frame_index];
+    const ImGuiCaptureFrameHeader* frame_header = (const ImGuiCaptureFrameHeader*)frame_start;
+    const unsigned char* frame_end = frame_start + frame_header->FrameSize;
+    const unsigned char* p = frame_start + sizeof(ImGuiCaptureFrameHeader);
+
+    while (DrawLists.Size < (int)frame_header->CmdListsCount)
+        DrawLists.push_back(IM_NEW(ImDrawList)(NULL));
+
+    DrawData.Clear();
+    DrawData.CmdLists = DrawLists.Data;
+    DrawData.DisplayPos = ImVec2(frame_header->DisplayPos[0], frame_header->DisplayPos[1]);
+    DrawData.DisplaySize = ImVec2(frame_header->DisplaySize[0], frame_header->DisplaySize[1]);
+    DrawData.FramebufferScale = ImVec2(frame_header->FramebufferScale[0], frame_header->FramebufferScale[1]);
+    for (int n = 0; n < (int)frame_header->CmdListsCount; n++)
+    {
+        if (sizeof(ImGuiCaptureListHeader) > (size_t)(frame_end - p))
+            break;
+        const ImGuiCaptureListHeader* list_header = (const ImGuiCaptureListHeader*)p;
+        const size_t cmds_size = (size_t)list_header->CmdCount * sizeof(ImGuiCaptureCmd);
+        const size_t vtx_size = IMGUI_CAPTURE_ALIGN((size_t)list_header->VtxCount * sizeof(ImDrawVert));
+        const size_t idx_size = IMGUI_CAPTURE_ALIGN((size_t)list_header->IdxCount * sizeof(ImDrawIdx));
+        const size_t glyphs_size = IMGUI_CAPTURE_ALIGN((size_t)list_header->GlyphCount * sizeof(ImDrawGlyph));
+        if (sizeof(ImGuiCaptureListHeader) + cmds_size + vtx_size + idx_size + glyphs_size > (size_t)(frame_end - p))
+            break;
+        p += sizeof(ImGuiCaptureListHeader);
+        const ImGuiCaptureCmd* cmds = (const ImGuiCaptureCmd*)p;
+        p += cmds_size;
+        const ImDrawVert* vtx = (const ImDrawVert*)p;
+        p += vtx_size;
+        const ImDrawIdx* idx = (const ImDrawIdx*)p;
+        p += idx_size;
+        const ImDrawGlyph* glyphs = (const ImDrawGlyph*)p;
+        p += glyphs_size;
+
+        // Commands must stay within the buffers of their list
+        bool cmds_valid = true;
+        for (int cmd_i = 0; cmd_i < (int)list_header->CmdCount && cmds_valid; cmd_i++)
+        {
+            const ImGuiCaptureCmd* cmd = &cmds[cmd_i];
+            if ((ImU64)cmd->IdxOffset + cmd->ElemCount > list_header->IdxCount || (ImU64)cmd->GlyphOffset + cmd->GlyphCount > list_header->GlyphCount)
+                cmds_valid = false;
+            else if (cmd->VtxOffset > list_header->VtxCount || (cmd->ElemCount > 0 && cmd->VtxOffset == list_header->VtxCount))
+                cmds_valid = false;
+        }
+        if (!cmds_valid)
+            break;
+
+        // Commands are decoded, vertices and indices are used in place
+        ImDrawList* draw_list = DrawLists[n];
+        draw_list->Flags = (ImDrawListFlags)list_header->Flags;
+        draw_list->CmdBuffer.resize((int)list_header->CmdCount);
+        for (int cmd_i = 0; cmd_i < (int)list_header->CmdCount; cmd_i++)
+        {
+            const ImGuiCaptureCmd* src = &cmds[cmd_i];
+            ImDrawCmd* dst = &draw_list->CmdBuffer[cmd_i];
+            dst->ClipRect = ImVec4(src->ClipRect[0], src->ClipRect[1], src->ClipRect[2], src->ClipRect[3]);
+            if (TextureRemapFn)
+                dst->TextureId = TextureRemapFn(src->TextureId, TextureRemapUserData);
+            else if (DefaultTextureId)
+                dst->TextureId = DefaultTextureId;
+            else
+                dst->TextureId = (ImTextureID)(intptr_t)src->TextureId;
+            dst->VtxOffset = src->VtxOffset;
+            dst->IdxOffset = src->IdxOffset;
+            dst->ElemCount = src->ElemCount;
+            dst->GlyphOffset = src->GlyphOffset;
+            dst->GlyphCount = src->GlyphCount;
+            dst->UserCallback = (src->CallbackType == 1) ? ImDrawCallback_ResetRenderState : NULL;
+            dst->UserCallbackData = NULL;
+            if (src->CallbackType == 2)
+                dst->ElemCount = 0; // User callbacks can't be replayed: turn into an empty command
+        }
+        draw_list->VtxBuffer.Data = (ImDrawVert*)vtx;
+        draw_list->VtxBuffer.Size = draw_list->VtxBuffer.Capacity = (int)list_header->VtxCount;
+        draw_list->IdxBuffer.Data = (ImDrawIdx*)idx;
+        draw_list->IdxBuffer.Size = draw_list->IdxBuffer.Capacity = (int)list_header->IdxCount;
+        draw_list->GlyphBuffer.Data = (ImDrawGlyph*)glyphs;
+        draw_list->GlyphBuffer.Size = draw_list->GlyphBuffer.Capacity = (int)list_header->GlyphCount;
+
+        DrawData.CmdListsCount++;
+        DrawData.TotalVtxCount += draw_list->VtxBuffer.Size;
+        DrawData.TotalIdxCount += draw_list->IdxBuffer.Size;
+        DrawData.TotalGlyphCount += draw_list->GlyphBuffer.Size;
+    }
+    DrawData.Valid = true;
+    return &DrawData;
+}
@@ -0,0 +1,71 @@
+// dear imgui: ImDrawData capture and replay
+// Record the ImDrawData of each frame into a compact binary stream, and replay it later without running any UI code.
+// This is meant to benchmark renderers and reproduce performance regressions offline: replay feeds any back-end at full speed.
+
+// File format (version 2, native endianness, all sections aligned to 8 bytes):
+//   Header: magic 'IMDC', u32 version, u32 byte order mark (0x01020304), u16 sizeof(ImDrawVert), u16 sizeof(ImDrawIdx), u32 reserved
+//   Frame:  u32 magic 'FRME', u32 frame size in bytes (including this header), u32 CmdListsCount, u32 reserved,
+//           f32 DisplayPos[2], f32 DisplaySize[2], f32 FramebufferScale[2]
+//           For each draw list: u32 cmd count, u32 vtx count, u32 idx count, u32 ImDrawListFlags, u32 glyph count, u32 reserved,
+//                               command records (see ImGuiCaptureCmd below), vertices, indices, glyph instances (ImDrawGlyph).
+// Replay maps the file in memory: ImDrawList::VtxBuffer/IdxBuffer/GlyphBuffer point straight into the mapping (no copy).
+// Glyph instances index the ImFontAtlas::GlyphTable of the recording process: replay them with the same fonts.
+// Commands are decoded because ImTextureID and callbacks are process specific. User callbacks can't be replayed and are skipped.
+
+#pragma once
+#include "imgui.h"
+#include <stdio.h>      // FILE
+
+// Command record as stored in the file
+struct ImGuiCaptureCmd
+{
+    float           ClipRect[4];
+    ImU64           TextureId;          // ImTextureID value at recording time, see ImGuiCaptureReader::TextureRemapFn
+    ImU32           VtxOffset;
+    ImU32           IdxOffset;
+    ImU32           ElemCount;
+    ImU32           GlyphOffset;
+    ImU32           GlyphCount;
+    ImU32           CallbackType;       // 0: none, 1: ImDrawCallback_ResetRenderState, 2: user callback (skipped on replay)
+};
+
+// Write frames into a capture file
+struct ImGuiCaptureWriter
+{
+    FILE*                   File;
+    int                     FramesCount;
+    ImVector<ImGuiCaptureCmd> TempCmds;
+
+    ImGuiCaptureWriter()    { File = NULL; FramesCount = 0; }
+    ~ImGuiCaptureWriter()   { Close(); }
+    IMGUI_API bool          Open(const char* filename);
+    IMGUI_API bool          WriteFrame(const ImDrawData* draw_data);    // Call after ImGui::Render(), e.g. with ImGui::GetDrawData()
+    IMGUI_API void          Close();
+};
+
+// Map a capture file and expose its frames as ImDrawData
+// - The ImDrawData returned by GetFrame() and its ImDrawList are owned by the reader. They stay valid until the next call to GetFrame() or Close().
+// - Vertex/index buffers point into the read-only mapping: don't modify them (e.g. don't call ImDrawData::DeIndexAllBuffers()).
+// - A frame is exposed up to its first draw list which is truncated or has commands outside of its buffers. Index values are not checked.
+struct ImGuiCaptureReader
+{
+    const unsigned char*    MappedData;
+    size_t                  MappedSize;
+    void*                   MappingHandle;      // Platform specific
+    ImVector<size_t>        FrameOffsets;       // Offset of each frame within MappedData
+    ImVector<ImDrawList*>   DrawLists;          // Pool of draw lists exposed by GetFrame()
+    ImDrawData              DrawData;
+
+    // Recorded texture identifiers are meaningless in the replaying process. When set, this is called to translate them.
+    // Otherwise DefaultTextureId is used for every command, or the recorded value is used as-is if DefaultTextureId is NULL (replaying in the recording process).
+    ImTextureID             (*TextureRemapFn)(ImU64 recorded_texture_id, void* user_data);
+    void*                   TextureRemapUserData;
+    ImTextureID             DefaultTextureId;
+
+    ImGuiCaptureReader()    { MappedData = NULL; MappedSize = 0; MappingHandle = NULL; TextureRemapFn = NULL; TextureRemapUserData = NULL; DefaultTextureId = NULL; }
+    ~ImGuiCaptureReader()   { Close(); }
+    IMGUI_API bool          Open(const char* filename);
+    IMGUI_API void          Close();
+    int                     GetFramesCount() const { return FrameOffsets.Size; }
+    IMGUI_API ImDrawData*   GetFrame(int frame_index);
+};
@@ -404,6 +404,10 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::Checkbox("io.ConfigWindowsResizeFromEdges", &io.ConfigWindowsResizeFromEdges);
             ImGui::SameLine(); HelpMarker("Enable resizing of windows from their edges and from the lower-left corner.\nThis requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback.");
             ImGui::Checkbox("io.ConfigWindowsMoveFromTitleBarOnly", &io.ConfigWindowsMoveFromTitleBarOnly);
+            ImGui::Checkbox("io.ConfigRenderMergeDrawLists", &io.ConfigRenderMergeDrawLists);
+            ImGui::SameLine(); HelpMarker("Merge the draw commands of consecutive windows into shared draw lists, when they use the same texture and clipping allows it.\nReduces draw calls, at the cost of copying vertices and indices every frame. See Metrics window for draw call counts.");
+            ImGui::Checkbox("io.ConfigRenderGlyphInstances", &io.ConfigRenderGlyphInstances);
+            ImGui::SameLine(); HelpMarker("Output text as glyph instances instead of vertices, when the renderer back-end supports it (ImGuiBackendFlags_RendererHasGlyphInstances).\nFewer bytes to upload, but text and triangles become two draw calls where they share a command.");
             ImGui::Checkbox("io.MouseDrawCursor", &io.MouseDrawCursor);
             ImGui::SameLine(); HelpMarker("Instruct Dear ImGui to render a mouse cursor itself. Note that a mouse cursor rendered via your application GPU rendering path will feel more laggy than hardware cursor, but will be more in sync with your other visuals.\n\nSome desktop applications may use both kinds of cursors (e.g. enable software cursor only when resizing/dragging something).");
             ImGui::Text("Also see Style->Rendering for rendering options.");
@@ -3680,6 +3684,8 @@ void ImGui::ShowAboutWindow(bool* p_open)
         if (io.ConfigWindowsResizeFromEdges)                            ImGui::Text("io.ConfigWindowsResizeFromEdges");
         if (io.ConfigWindowsMoveFromTitleBarOnly)                       ImGui::Text("io.ConfigWindowsMoveFromTitleBarOnly");
         if (io.ConfigWindowsMemoryCompactTimer >= 0.0f)                 ImGui::Text("io.ConfigWindowsMemoryCompactTimer = %.1ff", io.ConfigWindowsMemoryCompactTimer);
+        if (io.ConfigRenderMergeDrawLists)                              ImGui::Text("io.ConfigRenderMergeDrawLists");
+        if (io.ConfigRenderGlyphInstances)                              ImGui::Text("io.ConfigRenderGlyphInstances");
         ImGui::Text("io.BackendFlags: 0x%08X", io.BackendFlags);
         if (io.BackendFlags & ImGuiBackendFlags_HasGamepad)             ImGui::Text(" HasGamepad");
         if (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors)        ImGui::Text(" HasMouseCursors");
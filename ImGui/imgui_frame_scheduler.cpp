@@ -0,0 +1,89 @@
+// dear imgui: idle-aware frame scheduler
+// See imgui_frame_scheduler.h for usage.
+
+#include "imgui.h"
+#include "imgui_frame_scheduler.h"
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <time.h>       // clock_gettime, nanosleep
+#endif
+
+//-----------------------------------------------------------------------------
+// Default implementations
+//-----------------------------------------------------------------------------
+
+static double GetTimeFn_DefaultImpl(void*)
+{
+#if defined(_WIN32)
+    static LARGE_INTEGER frequency = {};
+    if (frequency.QuadPart == 0)
+        ::QueryPerformanceFrequency(&frequency);
+    LARGE_INTEGER counter;
+    ::QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#endif
+}
+
+// Sleep without waking up on inputs. Long waits are split, WaitForNextFrame() calls us again until the deadline.
+static bool WaitEventsFn_DefaultImpl(void*, double timeout)
+{
+    if (timeout > 1.0)
+        timeout = 1.0;
+#if defined(_WIN32)
+    ::Sleep((DWORD)(timeout * 1000.0));
+#else
+    struct timespec ts;
+    ts.tv_sec = (time_t)timeout;
+    ts.tv_nsec = (long)((timeout - (double)ts.tv_sec) * 1e9);
+    nanosleep(&ts, NULL);
+#endif
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+// ImGuiFrameScheduler
+//-----------------------------------------------------------------------------
+
+ImGuiFrameScheduler::ImGuiFrameScheduler()
+{
+    GetTimeFn = GetTimeFn_DefaultImpl;
+    WaitEventsFn = WaitEventsFn_DefaultImpl;
+    UserData = NULL;
+    MaxWaitTime = 0.1;
+    NextFrameTime = 0.0;
+    EventsPending.store(false);
+    FramesCount = EventWakeUpsCount = 0;
+}
+
+bool ImGuiFrameScheduler::WaitForNextFrame()
+{
+    bool events = EventsPending.exchange(false);
+    double time = GetTimeFn(UserData);
+    while (!events && time < NextFrameTime)
+    {
+        events = WaitEventsFn(UserData, NextFrameTime - time);
+        events |= EventsPending.exchange(false);
+        time = GetTimeFn(UserData);
+    }
+    if (events)
+        EventWakeUpsCount++;
+    return events;
+}
+
+void ImGuiFrameScheduler::FrameRendered()
+{
+    double wait_time = (double)ImGui::GetEventWaitingTime();
+    if (wait_time > MaxWaitTime)
+        wait_time = MaxWaitTime;
+    NextFrameTime = GetTimeFn(UserData) + wait_time;
+    FramesCount++;
+}
@@ -0,0 +1,48 @@
+// dear imgui: idle-aware frame scheduler
+// Skip frames while the UI is static: after each frame, block until new inputs arrive or until Dear ImGui needs a new frame
+// to animate something (see ImGui::GetEventWaitingTime()), instead of rebuilding the same UI in a loop.
+// The clock and the wait function are pluggable, to block on OS events (e.g. MsgWaitForMultipleObjects() on Windows, glfwWaitEventsTimeout() with GLFW)
+// or to drive the scheduler with a mock clock in headless tests.
+
+// Usage:
+//   ImGuiFrameScheduler scheduler;
+//   scheduler.WaitEventsFn = MyWaitEvents;     // Block on OS events
+//   while (running)
+//   {
+//       scheduler.WaitForNextFrame();           // Return when inputs arrived or a frame is needed
+//       [poll OS events, call the back-end NewFrame() functions]
+//       ImGui::NewFrame();
+//       [...]
+//       ImGui::Render();
+//       [render, present]
+//       scheduler.FrameRendered();              // Read ImGui::GetEventWaitingTime()
+//   }
+// Limitations:
+// - Inputs which are polled rather than signaled (e.g. gamepads polled by the platform back-end, or GetAsyncKeyState() in the application)
+//   are only noticed when waking up: MaxWaitTime bounds the wait (0.1 s by default). Set it to FLT_MAX only if WaitEventsFn wakes up on every input.
+// - NotifyEvents() can be called from any thread, but doesn't interrupt a WaitEventsFn which is already blocking: also post a platform event
+//   to wake it up (e.g. PostThreadMessage() on Windows, glfwPostEmptyEvent() with GLFW). Otherwise it is noticed after at most MaxWaitTime.
+// - Application-side animations must call ImGui::SetMaxWaitBeforeNextFrame() every frame while animating.
+
+#pragma once
+#include "imgui.h"
+#include <atomic>
+
+struct ImGuiFrameScheduler
+{
+    double          (*GetTimeFn)(void* user_data);                      // Monotonic clock, in seconds. Default to the system monotonic clock.
+    bool            (*WaitEventsFn)(void* user_data, double timeout);   // Block until inputs arrive or 'timeout' seconds elapsed, return true when inputs arrived. Default to sleeping without waking up on inputs.
+    void*           UserData;
+    double          MaxWaitTime;        // = 0.1        // Upper bound of a single wait, to poll inputs which are not signaled.
+
+    // [Internal]
+    double          NextFrameTime;      // Time at which a new frame is needed without new inputs, computed by FrameRendered()
+    std::atomic<bool> EventsPending;    // Set by NotifyEvents(), possibly from another thread
+    int             FramesCount;        // Number of calls to FrameRendered()
+    int             EventWakeUpsCount;  // Number of calls to WaitForNextFrame() which returned because of inputs
+
+    IMGUI_API       ImGuiFrameScheduler();
+    IMGUI_API bool  WaitForNextFrame();                                 // Block until inputs arrived or a new frame is needed. Return true when inputs arrived.
+    IMGUI_API void  FrameRendered();                                    // Call after ImGui::Render(), with the same clock as WaitForNextFrame()
+    void            NotifyEvents()      { EventsPending.store(true); }  // Inputs arrived outside of WaitEventsFn (e.g. from another thread): WaitForNextFrame() returns after the current wait, or immediately when not waiting
+};
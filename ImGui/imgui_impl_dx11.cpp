@@ -4,6 +4,8 @@
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'ID3D11ShaderResourceView*' as ImTextureID. Read the FAQ about ImTextureID!
 //  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Signed distance field glyphs (ImFontConfig::SignedDistanceField) stay sharp at any scale.
+//  [X] Renderer: Glyph instances (ImGuiBackendFlags_RendererHasGlyphInstances), expanded by an instanced vertex shader reading io.Fonts->GlyphTable. Used when io.ConfigRenderGlyphInstances is set.
 
 // You can copy and use unmodified imgui_impl_* files in your project. See main.cpp for an example of using this.
 // If you are new to dear imgui, read examples/README.txt and read the documentation at the top of imgui.cpp
@@ -11,6 +13,10 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-17: DirectX11: Draw ImDrawCmd::GlyphCount glyph instances with DrawInstanced(), enable ImGuiBackendFlags_RendererHasGlyphInstances flag.
+//  2026-10-17: DirectX11: Shade the signed distance field rows of the font texture (io.Fonts->TexSdfMinY/TexSdfMaxY) with a second pixel shader.
+//  2026-10-17: DirectX11: Upload io.Fonts->TexDirtyRects (glyphs rasterized on demand) at the beginning of ImGui_ImplDX11_RenderDrawData().
+//  2026-10-17: DirectX11: Support for IMGUI_USE_COMPACT_DRAWVERT (R16G16_SNORM positions scaled through the projection matrix, R16G16_UNORM uv).
 //  2019-08-01: DirectX11: Fixed code querying the Geometry Shader state (would generally error with Debug layer enabled).
 //  2019-07-21: DirectX11: Backup, clear and restore Geometry Shader is any is bound when calling ImGui_ImplDX10_RenderDrawData. Clearing Hull/Domain/Compute shaders without backup/restore.
 //  2019-05-29: DirectX11: Added support for large mesh (64K+ vertices), enable ImGuiBackendFlags_RendererHasVtxOffset flag.
@@ -46,6 +52,14 @@ static ID3D11VertexShader*      g_pVertexShader = NULL;
 static ID3D11InputLayout*       g_pInputLayout = NULL;
 static ID3D11Buffer*            g_pVertexConstantBuffer = NULL;
 static ID3D11PixelShader*       g_pPixelShader = NULL;
+static ID3D11PixelShader*       g_pPixelShaderSdf = NULL;       // Used for the font texture when it has signed distance field glyphs
+static ID3D11VertexShader*      g_pGlyphVertexShader = NULL;    // Expands one ImDrawGlyph instance into a quad
+static ID3D11InputLayout*       g_pGlyphInputLayout = NULL;
+static ID3D11Buffer*            g_pGlyphVB = NULL;
+static ID3D11Buffer*            g_pGlyphTable = NULL;           // Copy of io.Fonts->GlyphTable, 2 float4 per glyph
+static ID3D11ShaderResourceView*g_pGlyphTableView = NULL;
+static int                      g_GlyphBufferSize = 2000, g_GlyphTableSize = 0, g_GlyphTableVersion = -1;
+static ID3D11Buffer*            g_pPixelConstantBuffer = NULL;
 static ID3D11SamplerState*      g_pFontSampler = NULL;
 static ID3D11ShaderResourceView*g_pFontTextureView = NULL;
 static ID3D11RasterizerState*   g_pRasterizerState = NULL;
@@ -56,6 +70,16 @@ static int                      g_VertexBufferSize = 5000, g_IndexBufferSize = 1
 struct VERTEX_CONSTANT_BUFFER
 {
     float   mvp[4][4];
+    float   mvp_glyphs[4][4];   // Glyph instance positions are always in pixels (they differ from mvp with IMGUI_USE_COMPACT_DRAWVERT)
+};
+
+struct PIXEL_CONSTANT_BUFFER
+{
+    float   sdf_v[2];           // Range of v holding signed distance fields
+    float   sdf_on_edge;        // Alpha of the outlines
+    float   sdf_dist_scale;     // Distance in texels per unit of alpha
+    float   tex_size[2];
+    float   padding[2];
 };
 
 static void ImGui_ImplDX11_SetupRenderState(ImDrawData* draw_data, ID3D11DeviceContext* ctx)
@@ -80,6 +104,7 @@ static void ImGui_ImplDX11_SetupRenderState(ImDrawData* draw_data, ID3D11DeviceC
     ctx->VSSetShader(g_pVertexShader, NULL, 0);
     ctx->VSSetConstantBuffers(0, 1, &g_pVertexConstantBuffer);
     ctx->PSSetShader(g_pPixelShader, NULL, 0);
+    ctx->PSSetConstantBuffers(0, 1, &g_pPixelConstantBuffer);
     ctx->PSSetSamplers(0, 1, &g_pFontSampler);
     ctx->GSSetShader(NULL, NULL, 0);
     ctx->HSSetShader(NULL, NULL, 0); // In theory we should backup and restore this as well.. very infrequently used..
@@ -93,10 +118,83 @@ static void ImGui_ImplDX11_SetupRenderState(ImDrawData* draw_data, ID3D11DeviceC
     ctx->RSSetState(g_pRasterizerState);
 }
 
+// Switch between triangle lists and glyph instances. The rest of the render state is shared.
+static void ImGui_ImplDX11_SetupGlyphRenderState(ID3D11DeviceContext* ctx, bool glyphs)
+{
+    unsigned int stride = glyphs ? sizeof(ImDrawGlyph) : sizeof(ImDrawVert);
+    unsigned int offset = 0;
+    ctx->IASetInputLayout(glyphs ? g_pGlyphInputLayout : g_pInputLayout);
+    ctx->IASetVertexBuffers(0, 1, glyphs ? &g_pGlyphVB : &g_pVB, &stride, &offset);
+    ctx->IASetPrimitiveTopology(glyphs ? D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP : D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    ctx->VSSetShader(glyphs ? g_pGlyphVertexShader : g_pVertexShader, NULL, 0);
+    if (glyphs)
+        ctx->VSSetShaderResources(0, 1, &g_pGlyphTableView);
+}
+
+// Upload io.Fonts->GlyphTable when it changed (rebuilt, or on-demand glyphs loaded/evicted)
+static bool ImGui_ImplDX11_UpdateGlyphTable()
+{
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    if (g_pGlyphTable && g_GlyphTableVersion == atlas->GlyphTableVersion)
+        return true;
+    if (!g_pGlyphTable || g_GlyphTableSize < atlas->GlyphTable.Size)
+    {
+        if (g_pGlyphTableView) { g_pGlyphTableView->Release(); g_pGlyphTableView = NULL; }
+        if (g_pGlyphTable) { g_pGlyphTable->Release(); g_pGlyphTable = NULL; }
+        g_GlyphTableSize = atlas->GlyphTable.Size + 256;
+        D3D11_BUFFER_DESC desc;
+        memset(&desc, 0, sizeof(D3D11_BUFFER_DESC));
+        desc.Usage = D3D11_USAGE_DYNAMIC;
+        desc.ByteWidth = g_GlyphTableSize * sizeof(ImDrawGlyphQuad);
+        desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+        desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+        if (g_pd3dDevice->CreateBuffer(&desc, NULL, &g_pGlyphTable) < 0)
+            return false;
+        D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc;
+        ZeroMemory(&srvDesc, sizeof(srvDesc));
+        srvDesc.Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
+        srvDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
+        srvDesc.Buffer.FirstElement = 0;
+        srvDesc.Buffer.NumElements = g_GlyphTableSize * 2;
+        if (g_pd3dDevice->CreateShaderResourceView(g_pGlyphTable, &srvDesc, &g_pGlyphTableView) < 0)
+            return false;
+    }
+    D3D11_MAPPED_SUBRESOURCE mapped_resource;
+    if (g_pd3dDeviceContext->Map(g_pGlyphTable, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped_resource) != S_OK)
+        return false;
+    memcpy(mapped_resource.pData, atlas->GlyphTable.Data, (size_t)atlas->GlyphTable.size_in_bytes());
+    g_pd3dDeviceContext->Unmap(g_pGlyphTable, 0);
+    g_GlyphTableVersion = atlas->GlyphTableVersion;
+    return true;
+}
+
+// Upload the regions of the font atlas modified since the last frame (see ImFontConfig::GlyphsOnDemand, ImFontAtlas::BuildAppend)
+static void ImGui_ImplDX11_UpdateFontsTexture()
+{
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    if (atlas->TexDirtyRects.Size == 0)
+        return;
+    if (g_pFontTextureView != NULL && atlas->TexPixelsRGBA32 != NULL)
+    {
+        ID3D11Resource* texture = NULL;
+        g_pFontTextureView->GetResource(&texture);
+        for (int n = 0; n < atlas->TexDirtyRects.Size; n++)
+        {
+            const ImFontAtlasTexRect& r = atlas->TexDirtyRects[n];
+            D3D11_BOX box = { r.X, r.Y, 0, (UINT)(r.X + r.W), (UINT)(r.Y + r.H), 1 };
+            g_pd3dDeviceContext->UpdateSubresource(texture, 0, &box, atlas->TexPixelsRGBA32 + r.X + r.Y * atlas->TexWidth, atlas->TexWidth * 4, 0);
+        }
+        texture->Release();
+    }
+    atlas->TexDirtyRects.resize(0);
+}
+
 // Render function
 // (this used to be set in io.RenderDrawListsFn and called by ImGui::Render(), but you can now call this directly from your main loop)
 void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
 {
+    ImGui_ImplDX11_UpdateFontsTexture();
+
     // Avoid rendering when minimized
     if (draw_data->DisplaySize.x <= 0.0f || draw_data->DisplaySize.y <= 0.0f)
         return;
@@ -131,6 +229,21 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
         if (g_pd3dDevice->CreateBuffer(&desc, NULL, &g_pIB) < 0)
             return;
     }
+    if (draw_data->TotalGlyphCount > 0 && (!g_pGlyphVB || g_GlyphBufferSize < draw_data->TotalGlyphCount))
+    {
+        if (g_pGlyphVB) { g_pGlyphVB->Release(); g_pGlyphVB = NULL; }
+        g_GlyphBufferSize = draw_data->TotalGlyphCount + 2000;
+        D3D11_BUFFER_DESC desc;
+        memset(&desc, 0, sizeof(D3D11_BUFFER_DESC));
+        desc.Usage = D3D11_USAGE_DYNAMIC;
+        desc.ByteWidth = g_GlyphBufferSize * sizeof(ImDrawGlyph);
+        desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+        desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+        if (g_pd3dDevice->CreateBuffer(&desc, NULL, &g_pGlyphVB) < 0)
+            return;
+    }
+    if (draw_data->TotalGlyphCount > 0 && !ImGui_ImplDX11_UpdateGlyphTable())
+        return;
 
     // Upload vertex/index data into a single contiguous GPU buffer
     D3D11_MAPPED_SUBRESOURCE vtx_resource, idx_resource;
@@ -150,6 +263,20 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
     }
     ctx->Unmap(g_pVB, 0);
     ctx->Unmap(g_pIB, 0);
+    if (draw_data->TotalGlyphCount > 0)
+    {
+        D3D11_MAPPED_SUBRESOURCE glyph_resource;
+        if (ctx->Map(g_pGlyphVB, 0, D3D11_MAP_WRITE_DISCARD, 0, &glyph_resource) != S_OK)
+            return;
+        ImDrawGlyph* glyph_dst = (ImDrawGlyph*)glyph_resource.pData;
+        for (int n = 0; n < draw_data->CmdListsCount; n++)
+        {
+            const ImDrawList* cmd_list = draw_data->CmdLists[n];
+            memcpy(glyph_dst, cmd_list->GlyphBuffer.Data, cmd_list->GlyphBuffer.Size * sizeof(ImDrawGlyph));
+            glyph_dst += cmd_list->GlyphBuffer.Size;
+        }
+        ctx->Unmap(g_pGlyphVB, 0);
+    }
 
     // Setup orthographic projection matrix into our constant buffer
     // Our visible imgui space lies from draw_data->DisplayPos (top left) to draw_data->DisplayPos+data_data->DisplaySize (bottom right). DisplayPos is (0,0) for single viewport apps.
@@ -169,10 +296,35 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
             { 0.0f,         0.0f,           0.5f,       0.0f },
             { (R+L)/(L-R),  (T+B)/(B-T),    0.5f,       1.0f },
         };
+        memcpy(&constant_buffer->mvp_glyphs, mvp, sizeof(mvp));
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+        // Positions are read as normalized values: scale them back to pixels
+        mvp[0][0] *= IMGUI_COMPACT_DRAWVERT_POS_SCALE;
+        mvp[1][1] *= IMGUI_COMPACT_DRAWVERT_POS_SCALE;
+#endif
         memcpy(&constant_buffer->mvp, mvp, sizeof(mvp));
         ctx->Unmap(g_pVertexConstantBuffer, 0);
     }
 
+    // Setup signed distance field parameters of the font texture into our pixel constant buffer
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    const bool font_has_sdf = (atlas->TexSdfMaxY > atlas->TexSdfMinY && atlas->TexHeight > 0);
+    if (font_has_sdf)
+    {
+        D3D11_MAPPED_SUBRESOURCE mapped_resource;
+        if (ctx->Map(g_pPixelConstantBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped_resource) != S_OK)
+            return;
+        PIXEL_CONSTANT_BUFFER* constant_buffer = (PIXEL_CONSTANT_BUFFER*)mapped_resource.pData;
+        constant_buffer->sdf_v[0] = (float)atlas->TexSdfMinY / atlas->TexHeight;
+        constant_buffer->sdf_v[1] = (float)atlas->TexSdfMaxY / atlas->TexHeight;
+        constant_buffer->sdf_on_edge = atlas->SdfOnEdgeValue / 255.0f;
+        constant_buffer->sdf_dist_scale = 255.0f * atlas->SdfPadding / atlas->SdfOnEdgeValue;
+        constant_buffer->tex_size[0] = (float)atlas->TexWidth;
+        constant_buffer->tex_size[1] = (float)atlas->TexHeight;
+        constant_buffer->padding[0] = constant_buffer->padding[1] = 0.0f;
+        ctx->Unmap(g_pPixelConstantBuffer, 0);
+    }
+
     // Backup DX state that will be modified to restore it afterwards (unfortunately this is very ugly looking and verbose. Close your eyes!)
     struct BACKUP_DX11_STATE
     {
@@ -186,8 +338,10 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
         UINT                        StencilRef;
         ID3D11DepthStencilState*    DepthStencilState;
         ID3D11ShaderResourceView*   PSShaderResource;
+        ID3D11ShaderResourceView*   VSShaderResource;
         ID3D11SamplerState*         PSSampler;
         ID3D11PixelShader*          PS;
+        ID3D11Buffer*               PSConstantBuffer;
         ID3D11VertexShader*         VS;
         ID3D11GeometryShader*       GS;
         UINT                        PSInstancesCount, VSInstancesCount, GSInstancesCount;
@@ -206,9 +360,11 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
     ctx->OMGetBlendState(&old.BlendState, old.BlendFactor, &old.SampleMask);
     ctx->OMGetDepthStencilState(&old.DepthStencilState, &old.StencilRef);
     ctx->PSGetShaderResources(0, 1, &old.PSShaderResource);
+    ctx->VSGetShaderResources(0, 1, &old.VSShaderResource);
     ctx->PSGetSamplers(0, 1, &old.PSSampler);
     old.PSInstancesCount = old.VSInstancesCount = old.GSInstancesCount = 256;
     ctx->PSGetShader(&old.PS, old.PSInstances, &old.PSInstancesCount);
+    ctx->PSGetConstantBuffers(0, 1, &old.PSConstantBuffer);
     ctx->VSGetShader(&old.VS, old.VSInstances, &old.VSInstancesCount);
     ctx->VSGetConstantBuffers(0, 1, &old.VSConstantBuffer);
     ctx->GSGetShader(&old.GS, old.GSInstances, &old.GSInstancesCount);
@@ -220,11 +376,14 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
 
     // Setup desired DX state
     ImGui_ImplDX11_SetupRenderState(draw_data, ctx);
+    ID3D11PixelShader* bound_pixel_shader = g_pPixelShader;
+    bool bound_glyphs = false;
 
     // Render command lists
     // (Because we merged all buffers into a single one, we maintain our own offset into them)
     int global_idx_offset = 0;
     int global_vtx_offset = 0;
+    int global_glyph_offset = 0;
     ImVec2 clip_off = draw_data->DisplayPos;
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
@@ -240,6 +399,8 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
                     ImGui_ImplDX11_SetupRenderState(draw_data, ctx);
                 else
                     pcmd->UserCallback(cmd_list, pcmd);
+                bound_pixel_shader = g_pPixelShader;
+                bound_glyphs = false;
             }
             else
             {
@@ -249,12 +410,38 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
 
                 // Bind texture, Draw
                 ID3D11ShaderResourceView* texture_srv = (ID3D11ShaderResourceView*)pcmd->TextureId;
+                ID3D11PixelShader* pixel_shader = (font_has_sdf && texture_srv == g_pFontTextureView) ? g_pPixelShaderSdf : g_pPixelShader;
+                if (pixel_shader != bound_pixel_shader)
+                {
+                    ctx->PSSetShader(pixel_shader, NULL, 0);
+                    bound_pixel_shader = pixel_shader;
+                }
                 ctx->PSSetShaderResources(0, 1, &texture_srv);
-                ctx->DrawIndexed(pcmd->ElemCount, pcmd->IdxOffset + global_idx_offset, pcmd->VtxOffset + global_vtx_offset);
+
+                // Triangles first, then glyph instances: 4 vertices triangle strip per instance
+                if (pcmd->ElemCount > 0)
+                {
+                    if (bound_glyphs)
+                    {
+                        ImGui_ImplDX11_SetupGlyphRenderState(ctx, false);
+                        bound_glyphs = false;
+                    }
+                    ctx->DrawIndexed(pcmd->ElemCount, pcmd->IdxOffset + global_idx_offset, pcmd->VtxOffset + global_vtx_offset);
+                }
+                if (pcmd->GlyphCount > 0)
+                {
+                    if (!bound_glyphs)
+                    {
+                        ImGui_ImplDX11_SetupGlyphRenderState(ctx, true);
+                        bound_glyphs = true;
+                    }
+                    ctx->DrawInstanced(4, pcmd->GlyphCount, 0, pcmd->GlyphOffset + global_glyph_offset);
+                }
             }
         }
         global_idx_offset += cmd_list->IdxBuffer.Size;
         global_vtx_offset += cmd_list->VtxBuffer.Size;
+        global_glyph_offset += cmd_list->GlyphBuffer.Size;
     }
 
     // Restore modified DX state
@@ -264,8 +451,10 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
     ctx->OMSetBlendState(old.BlendState, old.BlendFactor, old.SampleMask); if (old.BlendState) old.BlendState->Release();
     ctx->OMSetDepthStencilState(old.DepthStencilState, old.StencilRef); if (old.DepthStencilState) old.DepthStencilState->Release();
     ctx->PSSetShaderResources(0, 1, &old.PSShaderResource); if (old.PSShaderResource) old.PSShaderResource->Release();
+    ctx->VSSetShaderResources(0, 1, &old.VSShaderResource); if (old.VSShaderResource) old.VSShaderResource->Release();
     ctx->PSSetSamplers(0, 1, &old.PSSampler); if (old.PSSampler) old.PSSampler->Release();
     ctx->PSSetShader(old.PS, old.PSInstances, old.PSInstancesCount); if (old.PS) old.PS->Release();
+    ctx->PSSetConstantBuffers(0, 1, &old.PSConstantBuffer); if (old.PSConstantBuffer) old.PSConstantBuffer->Release();
     for (UINT i = 0; i < old.PSInstancesCount; i++) if (old.PSInstances[i]) old.PSInstances[i]->Release();
     ctx->VSSetShader(old.VS, old.VSInstances, old.VSInstancesCount); if (old.VS) old.VS->Release();
     ctx->VSSetConstantBuffers(0, 1, &old.VSConstantBuffer); if (old.VSConstantBuffer) old.VSConstantBuffer->Release();
@@ -355,6 +544,7 @@ bool    ImGui_ImplDX11_CreateDeviceObjects()
             "cbuffer vertexBuffer : register(b0) \
             {\
               float4x4 ProjectionMatrix; \
+              float4x4 GlyphProjectionMatrix; \
             };\
             struct VS_INPUT\
             {\
@@ -391,8 +581,13 @@ bool    ImGui_ImplDX11_CreateDeviceObjects()
         // Create the input layout
         D3D11_INPUT_ELEMENT_DESC local_layout[] =
         {
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+            { "POSITION", 0, DXGI_FORMAT_R16G16_SNORM,   0, (UINT)IM_OFFSETOF(ImDrawVert, pos), D3D11_INPUT_PER_VERTEX_DATA, 0 },
+            { "TEXCOORD", 0, DXGI_FORMAT_R16G16_UNORM,   0, (UINT)IM_OFFSETOF(ImDrawVert, uv),  D3D11_INPUT_PER_VERTEX_DATA, 0 },
+#else
             { "POSITION", 0, DXGI_FORMAT_R32G32_FLOAT,   0, (UINT)IM_OFFSETOF(ImDrawVert, pos), D3D11_INPUT_PER_VERTEX_DATA, 0 },
             { "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT,   0, (UINT)IM_OFFSETOF(ImDrawVert, uv),  D3D11_INPUT_PER_VERTEX_DATA, 0 },
+#endif
             { "COLOR",    0, DXGI_FORMAT_R8G8B8A8_UNORM, 0, (UINT)IM_OFFSETOF(ImDrawVert, col), D3D11_INPUT_PER_VERTEX_DATA, 0 },
         };
         if (g_pd3dDevice->CreateInputLayout(local_layout, 3, vertexShaderBlob->GetBufferPointer(), vertexShaderBlob->GetBufferSize(), &g_pInputLayout) != S_OK)
@@ -414,6 +609,69 @@ bool    ImGui_ImplDX11_CreateDeviceObjects()
         }
     }
 
+    // Create the vertex shader expanding glyph instances (see ImGuiBackendFlags_RendererHasGlyphInstances)
+    // The quad and uv of a glyph are read from io.Fonts->GlyphTable, same math as ImFont::RenderText() with vertices.
+    {
+        static const char* glyphVertexShader =
+            "cbuffer vertexBuffer : register(b0) \
+            {\
+              float4x4 ProjectionMatrix; \
+              float4x4 GlyphProjectionMatrix; \
+            };\
+            Buffer<float4> GlyphTable : register(t0);\
+            struct VS_INPUT\
+            {\
+              float2 pos   : POSITION;\
+              float  scale : TEXCOORD1;\
+              float4 col   : COLOR0;\
+              uint   glyph : TEXCOORD2;\
+              uint   id    : SV_VertexID;\
+            };\
+            \
+            struct PS_INPUT\
+            {\
+              float4 pos : SV_POSITION;\
+              float4 col : COLOR0;\
+              float2 uv  : TEXCOORD0;\
+            };\
+            \
+            PS_INPUT main(VS_INPUT input)\
+            {\
+              float4 quad = GlyphTable.Load(input.glyph * 2);\
+              float4 quad_uv = GlyphTable.Load(input.glyph * 2 + 1);\
+              float2 corner = float2(input.id & 1, input.id >> 1);\
+              PS_INPUT output;\
+              output.pos = mul( GlyphProjectionMatrix, float4(input.pos + lerp(quad.xy, quad.zw, corner) * input.scale, 0.f, 1.f));\
+              output.col = input.col;\
+              output.uv  = lerp(quad_uv.xy, quad_uv.zw, corner);\
+              return output;\
+            }";
+
+        ID3DBlob* vertexShaderBlob;
+        if (FAILED(D3DCompile(glyphVertexShader, strlen(glyphVertexShader), NULL, NULL, NULL, "main", "vs_4_0", 0, 0, &vertexShaderBlob, NULL)))
+            return false;
+        if (g_pd3dDevice->CreateVertexShader(vertexShaderBlob->GetBufferPointer(), vertexShaderBlob->GetBufferSize(), NULL, &g_pGlyphVertexShader) != S_OK)
+        {
+            vertexShaderBlob->Release();
+            return false;
+        }
+
+        // One ImDrawGlyph per instance
+        D3D11_INPUT_ELEMENT_DESC local_layout[] =
+        {
+            { "POSITION", 0, DXGI_FORMAT_R32G32_FLOAT,   0, (UINT)IM_OFFSETOF(ImDrawGlyph, Pos),        D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+            { "TEXCOORD", 1, DXGI_FORMAT_R32_FLOAT,      0, (UINT)IM_OFFSETOF(ImDrawGlyph, Scale),      D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+            { "COLOR",    0, DXGI_FORMAT_R8G8B8A8_UNORM, 0, (UINT)IM_OFFSETOF(ImDrawGlyph, Col),        D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+            { "TEXCOORD", 2, DXGI_FORMAT_R32_UINT,       0, (UINT)IM_OFFSETOF(ImDrawGlyph, GlyphIndex), D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+        };
+        if (g_pd3dDevice->CreateInputLayout(local_layout, 4, vertexShaderBlob->GetBufferPointer(), vertexShaderBlob->GetBufferSize(), &g_pGlyphInputLayout) != S_OK)
+        {
+            vertexShaderBlob->Release();
+            return false;
+        }
+        vertexShaderBlob->Release();
+    }
+
     // Create the pixel shader
     {
         static const char* pixelShader =
@@ -443,6 +701,53 @@ bool    ImGui_ImplDX11_CreateDeviceObjects()
         pixelShaderBlob->Release();
     }
 
+    // Create the pixel shader for the font texture when it has signed distance field glyphs (see ImFontAtlas::TexSdfMinY)
+    // The derivatives are taken outside of the branch: they are undefined within non-uniform control flow.
+    {
+        static const char* pixelShaderSdf =
+            "cbuffer pixelBuffer : register(b0) \
+            {\
+            float4 SdfParams;\
+            float4 TexSize;\
+            };\
+            struct PS_INPUT\
+            {\
+            float4 pos : SV_POSITION;\
+            float4 col : COLOR0;\
+            float2 uv  : TEXCOORD0;\
+            };\
+            sampler sampler0;\
+            Texture2D texture0;\
+            \
+            float4 main(PS_INPUT input) : SV_Target\
+            {\
+            float4 tex_col = texture0.Sample(sampler0, input.uv); \
+            float texels_per_pixel = max(length(ddx(input.uv) * TexSize.xy), 1e-5); \
+            if (input.uv.y >= SdfParams.x && input.uv.y < SdfParams.y) \
+                tex_col = float4(1.0, 1.0, 1.0, saturate((tex_col.a - SdfParams.z) * SdfParams.w / texels_per_pixel + 0.5)); \
+            return input.col * tex_col; \
+            }";
+
+        ID3DBlob* pixelShaderBlob;
+        if (FAILED(D3DCompile(pixelShaderSdf, strlen(pixelShaderSdf), NULL, NULL, NULL, "main", "ps_4_0", 0, 0, &pixelShaderBlob, NULL)))
+            return false;
+        if (g_pd3dDevice->CreatePixelShader(pixelShaderBlob->GetBufferPointer(), pixelShaderBlob->GetBufferSize(), NULL, &g_pPixelShaderSdf) != S_OK)
+        {
+            pixelShaderBlob->Release();
+            return false;
+        }
+        pixelShaderBlob->Release();
+
+        D3D11_BUFFER_DESC desc;
+        desc.ByteWidth = sizeof(PIXEL_CONSTANT_BUFFER);
+        desc.Usage = D3D11_USAGE_DYNAMIC;
+        desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+        desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+        desc.MiscFlags = 0;
+        if (g_pd3dDevice->CreateBuffer(&desc, NULL, &g_pPixelConstantBuffer) != S_OK)
+            return false;
+    }
+
     // Create the blending setup
     {
         D3D11_BLEND_DESC desc;
@@ -498,14 +803,22 @@ void    ImGui_ImplDX11_InvalidateDeviceObjects()
     if (g_pFontTextureView) { g_pFontTextureView->Release(); g_pFontTextureView = NULL; ImGui::GetIO().Fonts->TexID = NULL; } // We copied g_pFontTextureView to io.Fonts->TexID so let's clear that as well.
     if (g_pIB) { g_pIB->Release(); g_pIB = NULL; }
     if (g_pVB) { g_pVB->Release(); g_pVB = NULL; }
+    if (g_pGlyphVB) { g_pGlyphVB->Release(); g_pGlyphVB = NULL; }
+    if (g_pGlyphTableView) { g_pGlyphTableView->Release(); g_pGlyphTableView = NULL; }
+    if (g_pGlyphTable) { g_pGlyphTable->Release(); g_pGlyphTable = NULL; }
+    g_GlyphTableVersion = -1;
 
     if (g_pBlendState) { g_pBlendState->Release(); g_pBlendState = NULL; }
     if (g_pDepthStencilState) { g_pDepthStencilState->Release(); g_pDepthStencilState = NULL; }
     if (g_pRasterizerState) { g_pRasterizerState->Release(); g_pRasterizerState = NULL; }
     if (g_pPixelShader) { g_pPixelShader->Release(); g_pPixelShader = NULL; }
+    if (g_pPixelShaderSdf) { g_pPixelShaderSdf->Release(); g_pPixelShaderSdf = NULL; }
+    if (g_pPixelConstantBuffer) { g_pPixelConstantBuffer->Release(); g_pPixelConstantBuffer = NULL; }
     if (g_pVertexConstantBuffer) { g_pVertexConstantBuffer->Release(); g_pVertexConstantBuffer = NULL; }
     if (g_pInputLayout) { g_pInputLayout->Release(); g_pInputLayout = NULL; }
     if (g_pVertexShader) { g_pVertexShader->Release(); g_pVertexShader = NULL; }
+    if (g_pGlyphInputLayout) { g_pGlyphInputLayout->Release(); g_pGlyphInputLayout = NULL; }
+    if (g_pGlyphVertexShader) { g_pGlyphVertexShader->Release(); g_pGlyphVertexShader = NULL; }
 }
 
 bool    ImGui_ImplDX11_Init(ID3D11Device* device, ID3D11DeviceContext* device_context)
@@ -513,7 +826,8 @@ bool    ImGui_ImplDX11_Init(ID3D11Device* device, ID3D11DeviceContext* device_co
     // Setup back-end capabilities flags
     ImGuiIO& io = ImGui::GetIO();
     io.BackendRendererName = "imgui_impl_dx11";
-    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;      // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasGlyphInstances; // We can honor the ImDrawCmd::GlyphOffset/GlyphCount fields, drawing text from glyph instances (only output with io.ConfigRenderGlyphInstances).
 
     // Get factory from device
     IDXGIDevice* pDXGIDevice = NULL;
@@ -0,0 +1,212 @@
+// dear imgui: Null Platform + Renderer Binding (headless, no window and no GPU)
+// This is meant to drive frames on machines without a display (e.g. Linux build boxes) for benchmarking and regression testing.
+
+// Implemented features:
+//  [X] Platform: Synthetic display size, delta time, mouse and keyboard state. Keyboard arrays are indexed using ImGuiKey_ values (io.KeyMap[] is 1:1).
+//  [X] Renderer: Consumes ImDrawData by copying vertex/index data into a staging buffer (emulating a GPU upload) and walking every ImDrawCmd.
+//  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Glyph instances are copied along with vertices. The flag is not set by default: set ImGuiBackendFlags_RendererHasGlyphInstances and io.ConfigRenderGlyphInstances yourself to measure them.
+
+// Typical usage:
+//   ImGui::CreateContext();
+//   ImGui_ImplNull_Init(1920.0f, 1080.0f);
+//   ImGui_ImplNull_RunFrames(1000, MyUiFunction, NULL, stats);
+//   ImGui_ImplNull_Shutdown();
+//   ImGui::DestroyContext();
+
+#include "imgui.h"
+#include "imgui_impl_null.h"
+#include <string.h>     // memcpy
+#include <stdint.h>     // intptr_t
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <time.h>       // clock_gettime
+#endif
+
+// Null Data
+static ImVec2                       g_DisplaySize = ImVec2(0.0f, 0.0f);
+static float                        g_FixedDeltaTime = 1.0f / 60.0f;
+static double                       g_Time = 0.0;
+static ImVector<ImDrawVert>         g_VtxStaging;   // Stand-ins for the GPU vertex/index buffers
+static ImVector<ImDrawIdx>          g_IdxStaging;
+static ImVector<ImDrawGlyph>        g_GlyphStaging;
+static ImGui_ImplNull_FrameStats    g_LastRenderStats;
+
+// Functions
+double  ImGui_ImplNull_GetTime()
+{
+#if defined(_WIN32)
+    static LARGE_INTEGER frequency = {};
+    if (frequency.QuadPart == 0)
+        ::QueryPerformanceFrequency(&frequency);
+    LARGE_INTEGER counter;
+    ::QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#endif
+}
+
+bool    ImGui_ImplNull_Init(float display_width, float display_height)
+{
+    // Setup back-end capabilities flags
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendPlatformName = "imgui_impl_null";
+    io.BackendRendererName = "imgui_impl_null";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+
+    // Keyboard mapping. There is no native key code here: io.KeysDown[] is indexed directly with ImGuiKey_ values.
+    for (int key = 0; key < ImGuiKey_COUNT; key++)
+        io.KeyMap[key] = key;
+
+    g_DisplaySize = ImVec2(display_width, display_height);
+    g_Time = 0.0;
+    memset(&g_LastRenderStats, 0, sizeof(g_LastRenderStats));
+
+    // Build texture atlas. There is no texture to upload: any non-NULL identifier will do.
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    io.Fonts->TexID = (ImTextureID)(intptr_t)1;
+
+    return true;
+}
+
+void    ImGui_ImplNull_Shutdown()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    io.Fonts->TexID = NULL;
+    g_VtxStaging.clear();
+    g_IdxStaging.clear();
+    g_GlyphStaging.clear();
+}
+
+void    ImGui_ImplNull_SetDisplaySize(float display_width, float display_height)
+{
+    g_DisplaySize = ImVec2(display_width, display_height);
+}
+
+void    ImGui_ImplNull_SetFixedDeltaTime(float delta_time)
+{
+    g_FixedDeltaTime = delta_time;
+}
+
+void    ImGui_ImplNull_NewFrame()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IM_ASSERT(io.Fonts->IsBuilt() && "Font atlas not built! It is generally built by the renderer back-end. Missing call to renderer _NewFrame() function? e.g. ImGui_ImplOpenGL3_NewFrame().");
+
+    // Setup display size (every frame to accommodate for window resizing)
+    io.DisplaySize = g_DisplaySize;
+    io.DisplayFramebufferScale = ImVec2(1.0f, 1.0f);
+
+    // Setup time step
+    double current_time = ImGui_ImplNull_GetTime();
+    if (g_FixedDeltaTime > 0.0f)
+        io.DeltaTime = g_FixedDeltaTime;
+    else
+        io.DeltaTime = g_Time > 0.0 ? (float)(current_time - g_Time) : (float)(1.0f / 60.0f);
+    if (io.DeltaTime <= 0.0f)
+        io.DeltaTime = 0.00001f;
+    g_Time = current_time;
+}
+
+// Render function
+void    ImGui_ImplNull_RenderDrawData(ImDrawData* draw_data)
+{
+    double t0 = ImGui_ImplNull_GetTime();
+    ImGui_ImplNull_FrameStats& stats = g_LastRenderStats;
+    memset(&stats, 0, sizeof(stats));
+
+    // Avoid rendering when minimized
+    if (draw_data->DisplaySize.x <= 0.0f || draw_data->DisplaySize.y <= 0.0f)
+        return;
+
+    // There is no font texture to update with the glyphs rasterized on demand
+    ImGui::GetIO().Fonts->TexDirtyRects.resize(0);
+
+    // Upload vertex/index/glyph data into a single contiguous buffer, the same way a GPU renderer would
+    g_VtxStaging.resize(draw_data->TotalVtxCount);
+    g_IdxStaging.resize(draw_data->TotalIdxCount);
+    g_GlyphStaging.resize(draw_data->TotalGlyphCount);
+    ImDrawVert* vtx_dst = g_VtxStaging.Data;
+    ImDrawIdx* idx_dst = g_IdxStaging.Data;
+    ImDrawGlyph* glyph_dst = g_GlyphStaging.Data;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        memcpy(vtx_dst, cmd_list->VtxBuffer.Data, cmd_list->VtxBuffer.Size * sizeof(ImDrawVert));
+        stats.TotalVtxBytes += cmd_list->VtxBuffer.size_in_bytes();
+        memcpy(idx_dst, cmd_list->IdxBuffer.Data, cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx));
+        if (cmd_list->GlyphBuffer.Size > 0)
+            memcpy(glyph_dst, cmd_list->GlyphBuffer.Data, cmd_list->GlyphBuffer.Size * sizeof(ImDrawGlyph));
+        vtx_dst += cmd_list->VtxBuffer.Size;
+        idx_dst += cmd_list->IdxBuffer.Size;
+        glyph_dst += cmd_list->GlyphBuffer.Size;
+    }
+
+    // Walk command lists
+    ImVec2 clip_off = draw_data->DisplayPos;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != NULL)
+            {
+                // User callback, registered via ImDrawList::AddCallback()
+                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+                if (pcmd->UserCallback != ImDrawCallback_ResetRenderState)
+                    pcmd->UserCallback(cmd_list, pcmd);
+            }
+            else
+            {
+                // Skip commands which would be entirely scissored out. Triangles and glyph instances of a command are two draw calls.
+                ImVec4 clip_rect = ImVec4(pcmd->ClipRect.x - clip_off.x, pcmd->ClipRect.y - clip_off.y, pcmd->ClipRect.z - clip_off.x, pcmd->ClipRect.w - clip_off.y);
+                if (clip_rect.x < draw_data->DisplaySize.x && clip_rect.y < draw_data->DisplaySize.y && clip_rect.z >= 0.0f && clip_rect.w >= 0.0f)
+                    stats.DrawCmdCount += (pcmd->ElemCount > 0 && pcmd->GlyphCount > 0) ? 2 : 1;
+            }
+        }
+    }
+
+    stats.CmdListsCount = draw_data->CmdListsCount;
+    stats.TotalVtxCount = draw_data->TotalVtxCount;
+    stats.TotalIdxCount = draw_data->TotalIdxCount;
+    stats.TotalGlyphCount = draw_data->TotalGlyphCount;
+    stats.RenderTimeMs = (ImGui_ImplNull_GetTime() - t0) * 1000.0;
+}
+
+const ImGui_ImplNull_FrameStats* ImGui_ImplNull_GetLastRenderStats()
+{
+    return &g_LastRenderStats;
+}
+
+void    ImGui_ImplNull_RunFrames(int frame_count, ImGui_ImplNull_FrameCallback ui_callback, void* user_data, ImGui_ImplNull_FrameStats* out_frame_stats, ImGui_ImplNull_FrameCallback input_callback)
+{
+    for (int frame_n = 0; frame_n < frame_count; frame_n++)
+    {
+        double t0 = ImGui_ImplNull_GetTime();
+        ImGui_ImplNull_NewFrame();
+        if (input_callback)
+            input_callback(frame_n, user_data);
+        ImGui::NewFrame();
+        if (ui_callback)
+            ui_callback(frame_n, user_data);
+        ImGui::Render();
+        ImGui_ImplNull_RenderDrawData(ImGui::GetDrawData());
+        double t1 = ImGui_ImplNull_GetTime();
+
+        if (out_frame_stats)
+        {
+            out_frame_stats[frame_n] = g_LastRenderStats;
+            out_frame_stats[frame_n].FrameTimeMs = (t1 - t0) * 1000.0;
+        }
+    }
+}
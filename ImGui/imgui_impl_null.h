@@ -0,0 +1,44 @@
+// dear imgui: Null Platform + Renderer Binding (headless, no window and no GPU)
+// This is meant to drive frames on machines without a display (e.g. Linux build boxes) for benchmarking and regression testing.
+
+// Implemented features:
+//  [X] Platform: Synthetic display size, delta time, mouse and keyboard state. Keyboard arrays are indexed using ImGuiKey_ values (io.KeyMap[] is 1:1).
+//  [X] Renderer: Consumes ImDrawData by copying vertex/index data into a staging buffer (emulating a GPU upload) and walking every ImDrawCmd.
+//  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Glyph instances are copied along with vertices. The flag is not set by default: set ImGuiBackendFlags_RendererHasGlyphInstances and io.ConfigRenderGlyphInstances yourself to measure them.
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+
+// Statistics gathered for one frame by ImGui_ImplNull_RunFrames() / ImGui_ImplNull_RenderDrawData()
+struct ImGui_ImplNull_FrameStats
+{
+    double  FrameTimeMs;        // CPU time for NewFrame() + UI callback + Render() + RenderDrawData()
+    double  RenderTimeMs;       // CPU time spent in ImGui_ImplNull_RenderDrawData() alone
+    int     CmdListsCount;      // Number of ImDrawList submitted
+    int     DrawCmdCount;       // Number of ImDrawCmd which would have been issued as a draw call (excluding user callbacks)
+    int     TotalVtxCount;      // Sum of all ImDrawList::VtxBuffer.Size
+    int     TotalIdxCount;      // Sum of all ImDrawList::IdxBuffer.Size
+    int     TotalGlyphCount;    // Sum of all ImDrawList::GlyphBuffer.Size
+    int     TotalVtxBytes;      // Vertex bytes copied to the staging buffer (sum of all ImDrawList::VtxBuffer.size_in_bytes())
+};
+
+// Called once per frame. For the UI callback: between ImGui::NewFrame() and ImGui::Render(). For the input callback: after ImGui_ImplNull_NewFrame() and before ImGui::NewFrame(), to write into ImGuiIO.
+typedef void (*ImGui_ImplNull_FrameCallback)(int frame_index, void* user_data);
+
+IMGUI_IMPL_API bool     ImGui_ImplNull_Init(float display_width, float display_height);
+IMGUI_IMPL_API void     ImGui_ImplNull_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplNull_NewFrame();
+IMGUI_IMPL_API void     ImGui_ImplNull_RenderDrawData(ImDrawData* draw_data);
+
+// Configuration
+// - A fixed delta time keeps runs deterministic (default to 1/60). Pass 0.0f to use the real elapsed time instead.
+IMGUI_IMPL_API void     ImGui_ImplNull_SetDisplaySize(float display_width, float display_height);
+IMGUI_IMPL_API void     ImGui_ImplNull_SetFixedDeltaTime(float delta_time);
+
+// Frame pump: run 'frame_count' complete frames of 'ui_callback'. 'out_frame_stats' (optional) must point to 'frame_count' elements.
+IMGUI_IMPL_API void     ImGui_ImplNull_RunFrames(int frame_count, ImGui_ImplNull_FrameCallback ui_callback, void* user_data, ImGui_ImplNull_FrameStats* out_frame_stats = NULL, ImGui_ImplNull_FrameCallback input_callback = NULL);
+
+// Helpers
+IMGUI_IMPL_API double   ImGui_ImplNull_GetTime();                                       // Monotonic clock, in seconds
+IMGUI_IMPL_API const ImGui_ImplNull_FrameStats* ImGui_ImplNull_GetLastRenderStats();    // Counters from the last call to ImGui_ImplNull_RenderDrawData()
@@ -0,0 +1,844 @@
+// dear imgui: Renderer for software rasterization into a CPU framebuffer (no GPU required)
+// This needs to be used along with a Platform Binding (e.g. Win32, or the headless Null binding)
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoft_Texture*' as ImTextureID. Read the FAQ about ImTextureID!
+//  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Multi-threaded. Triangles are binned into screen tiles, tiles are rasterized in parallel on a thread pool.
+//  [X] Renderer: Support for IMGUI_USE_COMPACT_DRAWVERT (positions and uv are converted back to float during triangle setup).
+//  [X] Renderer: Signed distance field glyphs (ImFontConfig::SignedDistanceField) stay sharp at any scale.
+//  [X] Renderer: Glyph instances (ImGuiBackendFlags_RendererHasGlyphInstances), when io.ConfigRenderGlyphInstances is set.
+// Missing features:
+//  [ ] Renderer: Textures are point sampled (except signed distance fields). Dear ImGui output is pixel aligned so text and shapes match a GPU, but scaled user images will look blocky.
+
+// How it works:
+// - Every triangle is set up once (28.4 fixed point edge functions, top-left fill rule, attribute gradients) and binned into the 64x64 tiles it touches.
+// - Within a tile, the covered span of each row is solved exactly from the edge functions, then filled (SSE2 blending for constant color spans).
+// - Pairs of triangles emitted by PrimRect()/PrimRectUV() (most of ImGui geometry: glyphs, frames, backgrounds) are detected and rasterized as axis aligned rectangles.
+// - Glyph instances are expanded through ImFontAtlas::GlyphTable into the exact quads ImFont::RenderText() outputs otherwise, so pixels don't change.
+// - Primitives sampling the signed distance field rows of a texture get the ratio between field distances and framebuffer pixels at setup, and are shaded from bilinear filtered distances.
+// - Tiles are then rasterized independently, in submission order within a tile, so no locking is required when writing pixels.
+// - Blending matches the DirectX11 renderer: color = src * src_alpha + dst * (1 - src_alpha), alpha = src_alpha + dst_alpha * (1 - src_alpha).
+
+#include "imgui.h"
+#include "imgui_impl_soft.h"
+#include <math.h>       // sqrtf
+#include <string.h>     // memset
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Use SSE2 to blend 4 pixels at once, when available
+#if (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)) && !defined(IMGUI_IMPL_SOFT_DISABLE_SSE)
+#define IMGUI_IMPL_SOFT_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+#define IMGUI_IMPL_SOFT_TILE_SIZE       64
+#define IMGUI_IMPL_SOFT_SUBPIXEL_BITS   4
+#define IMGUI_IMPL_SOFT_SUBPIXEL_ONE    (1 << IMGUI_IMPL_SOFT_SUBPIXEL_BITS)
+
+// Render state shared by every primitive of a ImDrawCmd
+struct ImGui_ImplSoft_DrawState
+{
+    int                             ClipMinX, ClipMinY, ClipMaxX, ClipMaxY;     // In framebuffer pixels, max is exclusive
+    const ImGui_ImplSoft_Texture*   Texture;                                    // NULL: sample as opaque white
+};
+
+// A triangle or an axis aligned rectangle, set up once and shared by every tile it overlaps
+struct ImGui_ImplSoft_Prim
+{
+    int     MinX, MinY, MaxX, MaxY;     // Bounding box in framebuffer pixels, already clipped. Max is exclusive.
+    int     TileMinX, TileMinY, TileMaxX, TileMaxY;
+    int     StateIdx;
+    bool    IsRect;
+    bool    UniformCol;                 // All vertices have the same color
+    bool    UniformUV;                  // All vertices sample the same texel (e.g. the white pixel)
+    ImU32   Col;                        // Vertex color when UniformCol, pre-multiplied with the texel when UniformUV too.
+    // Triangle: E(x,y) = A*x + B*y + C in fixed point, >= 0 inside. C includes the top-left fill rule bias. Edge n is opposite to vertex n.
+    int     A[3], B[3];
+    ImS64   C[3];
+    ImVec2  V0;                         // Triangle: position of vertex 0 in framebuffer pixels
+    ImVec2  L1Grad, L2Grad;             // Triangle: gradients of the barycentric coordinates of v1/v2 per pixel, relative to V0
+    ImVec2  Uv0, UvD1, UvD2;            // Triangle: uv(v0) and deltas toward v1/v2. Rect: uv at pixel origin (0,0) and uv derivatives along x/y (in UvD1).
+    ImVec4  Col0, ColD1, ColD2;         // Triangle: color(v0) and deltas toward v1/v2, used when !UniformCol
+    float   SdfScale;                   // > 0.0f: samples signed distance fields, coverage = (alpha - Texture->SdfOnEdge) * SdfScale + 0.5f
+};
+
+// Soft Data
+static int                                  g_ThreadCount = 1;
+static ImGui_ImplSoft_Texture               g_FontTexture;
+static ImVector<ImU32>                      g_FontPixels;       // Copy of io.Fonts->TexPixelsRGBA32 sampled by g_FontTexture, kept up to date through TexDirtyRects
+static bool                                 g_FontTextureCreated = false;
+static ImVector<ImGui_ImplSoft_DrawState>   g_States;
+static ImVector<ImGui_ImplSoft_Prim>        g_Prims;
+static ImVector<int>                        g_TileBinOffsets;   // tiles_count + 1 entries, prefix sums into g_TileBinPrims
+static ImVector<int>                        g_TileBinPrims;
+static ImVector<int>                        g_TileBinCursor;
+
+// Current job (written by the calling thread before waking workers)
+static ImU32*                               g_JobFramebuffer = NULL;
+static int                                  g_JobStride = 0;
+static int                                  g_JobWidth = 0, g_JobHeight = 0;
+static int                                  g_JobTilesX = 0, g_JobTilesY = 0;
+
+// Thread pool
+static std::thread*                         g_Workers = NULL;
+static int                                  g_WorkersCount = 0;
+static std::mutex                           g_WorkersMutex;
+static std::condition_variable              g_WorkersWakeCond;
+static std::condition_variable              g_WorkersDoneCond;
+static unsigned int                         g_WorkersGeneration = 0;
+static int                                  g_WorkersBusy = 0;
+static bool                                 g_WorkersQuit = false;
+static std::atomic<int>                     g_NextTile(0);
+
+//-----------------------------------------------------------------------------
+// Pixel helpers
+//-----------------------------------------------------------------------------
+
+// x / 255 with rounding, for two 16-bit lanes at once (0x00FF00FF layout)
+static inline ImU32 ImGui_ImplSoft_Div255x2(ImU32 v)
+{
+    v += 0x00800080;
+    return ((v + ((v >> 8) & 0x00FF00FF)) >> 8) & 0x00FF00FF;
+}
+
+static inline ImU32 ImGui_ImplSoft_Div255(ImU32 v)
+{
+    v += 0x80;
+    return (v + (v >> 8)) >> 8;
+}
+
+// Per-channel multiply (vertex color * texel)
+static inline ImU32 ImGui_ImplSoft_Modulate(ImU32 a, ImU32 b)
+{
+    if (b == 0xFFFFFFFF)
+        return a;
+    ImU32 c0 = ImGui_ImplSoft_Div255(((a >> 0) & 0xFF) * ((b >> 0) & 0xFF));
+    ImU32 c1 = ImGui_ImplSoft_Div255(((a >> 8) & 0xFF) * ((b >> 8) & 0xFF));
+    ImU32 c2 = ImGui_ImplSoft_Div255(((a >> 16) & 0xFF) * ((b >> 16) & 0xFF));
+    ImU32 c3 = ImGui_ImplSoft_Div255(((a >> 24) & 0xFF) * ((b >> 24) & 0xFF));
+    return c0 | (c1 << 8) | (c2 << 16) | (c3 << 24);
+}
+
+// Alpha is always stored in the top byte, whether IMGUI_USE_BGRA_PACKED_COLOR is defined or not
+static inline ImU32 ImGui_ImplSoft_Blend(ImU32 dst, ImU32 src)
+{
+    ImU32 sa = src >> 24;
+    if (sa == 0xFF)
+        return src;
+    if (sa == 0)
+        return dst;
+    ImU32 inv_sa = 255 - sa;
+    ImU32 rb = ImGui_ImplSoft_Div255x2((src & 0x00FF00FF) * sa + (dst & 0x00FF00FF) * inv_sa);
+    ImU32 g = ImGui_ImplSoft_Div255(((src >> 8) & 0xFF) * sa + ((dst >> 8) & 0xFF) * inv_sa);
+    ImU32 a = ImGui_ImplSoft_Div255(255 * sa + (dst >> 24) * inv_sa);
+    return rb | (g << 8) | (a << 24);
+}
+
+static inline ImU32 ImGui_ImplSoft_Sample(const ImGui_ImplSoft_Texture* tex, float u, float v)
+{
+    if (tex == NULL)
+        return 0xFFFFFFFF;
+    int x = (int)(u * tex->Width);
+    int y = (int)(v * tex->Height);
+    x = (x < 0) ? 0 : (x >= tex->Width) ? tex->Width - 1 : x;
+    y = (y < 0) ? 0 : (y >= tex->Height) ? tex->Height - 1 : y;
+    return tex->Pixels[y * tex->Width + x];
+}
+
+// Bilinear filtered alpha of a signed distance field texel, clamped to the rows of the field
+static inline float ImGui_ImplSoft_SampleSdf(const ImGui_ImplSoft_Texture* tex, float u, float v)
+{
+    const float fx = u * tex->Width - 0.5f;
+    const float fy = v * tex->Height - 0.5f;
+    const int x0 = (int)(fx + 1.0f) - 1;    // floor() for fx >= -1.0f
+    const int y0 = (int)(fy + 1.0f) - 1;
+    const float tx = fx - (float)x0, ty = fy - (float)y0;
+    const int xa = (x0 < 0) ? 0 : (x0 >= tex->Width) ? tex->Width - 1 : x0;
+    const int xb = (x0 + 1 < 0) ? 0 : (x0 + 1 >= tex->Width) ? tex->Width - 1 : x0 + 1;
+    const int ya = (y0 < tex->SdfMinY) ? tex->SdfMinY : (y0 >= tex->SdfMaxY) ? tex->SdfMaxY - 1 : y0;
+    const int yb = (y0 + 1 < tex->SdfMinY) ? tex->SdfMinY : (y0 + 1 >= tex->SdfMaxY) ? tex->SdfMaxY - 1 : y0 + 1;
+    const ImU32* row_a = tex->Pixels + ya * tex->Width;
+    const ImU32* row_b = tex->Pixels + yb * tex->Width;
+    const float a = (float)(row_a[xa] >> 24) + ((float)(row_a[xb] >> 24) - (float)(row_a[xa] >> 24)) * tx;
+    const float b = (float)(row_b[xa] >> 24) + ((float)(row_b[xb] >> 24) - (float)(row_b[xa] >> 24)) * tx;
+    return a + (b - a) * ty;
+}
+
+// Coverage of a pixel by a signed distance field glyph, as a white texel
+static inline ImU32 ImGui_ImplSoft_ShadeSdf(const ImGui_ImplSoft_Texture* tex, float sdf_scale, float u, float v)
+{
+    const float coverage = (ImGui_ImplSoft_SampleSdf(tex, u, v) - tex->SdfOnEdge) * sdf_scale + 0.5f;
+    if (coverage <= 0.0f)
+        return 0;
+    return (coverage >= 1.0f) ? 0xFFFFFFFF : (((ImU32)(coverage * 255.0f + 0.5f) << 24) | 0x00FFFFFF);
+}
+
+static inline ImU32 ImGui_ImplSoft_PackChannel(float v)
+{
+    return (v <= 0.0f) ? 0 : (v >= 255.0f) ? 255 : (ImU32)(v + 0.5f);
+}
+
+static inline ImU32 ImGui_ImplSoft_PackColor(const ImVec4& c)
+{
+    return IM_COL32(ImGui_ImplSoft_PackChannel(c.x), ImGui_ImplSoft_PackChannel(c.y), ImGui_ImplSoft_PackChannel(c.z), ImGui_ImplSoft_PackChannel(c.w));
+}
+
+static inline ImVec4 ImGui_ImplSoft_UnpackColor(ImU32 c)
+{
+    return ImVec4((float)((c >> IM_COL32_R_SHIFT) & 0xFF), (float)((c >> IM_COL32_G_SHIFT) & 0xFF), (float)((c >> IM_COL32_B_SHIFT) & 0xFF), (float)((c >> IM_COL32_A_SHIFT) & 0xFF));
+}
+
+static inline int ImGui_ImplSoft_Min(int a, int b) { return a < b ? a : b; }
+static inline int ImGui_ImplSoft_Max(int a, int b) { return a > b ? a : b; }
+
+// floor(a / b) for b > 0
+static inline int ImGui_ImplSoft_FloorDiv(int a, int b)
+{
+    return (a >= 0) ? (a / b) : -((-a + b - 1) / b);
+}
+
+static inline int ImGui_ImplSoft_ToFixed(float v)
+{
+    // Positions far outside of the framebuffer are clamped so that edge function coefficients stay within 32-bit.
+    const float limit = 16384.0f;
+    v = (v < -limit) ? -limit : (v > limit) ? limit : v;
+    float f = v * (float)IMGUI_IMPL_SOFT_SUBPIXEL_ONE + 0.5f;
+    int i = (int)f;
+    return (f < (float)i) ? i - 1 : i;
+}
+
+//-----------------------------------------------------------------------------
+// Setup and binning
+//-----------------------------------------------------------------------------
+
+static bool ImGui_ImplSoft_SetupTriangle(ImGui_ImplSoft_Prim& prim, const ImDrawVert* v0, const ImDrawVert* v1, const ImDrawVert* v2, const ImVec2& off, const ImVec2& scale)
+{
+    int x[3], y[3];
+    x[0] = ImGui_ImplSoft_ToFixed((v0->pos.x - off.x) * scale.x); y[0] = ImGui_ImplSoft_ToFixed((v0->pos.y - off.y) * scale.y);
+    x[1] = ImGui_ImplSoft_ToFixed((v1->pos.x - off.x) * scale.x); y[1] = ImGui_ImplSoft_ToFixed((v1->pos.y - off.y) * scale.y);
+    x[2] = ImGui_ImplSoft_ToFixed((v2->pos.x - off.x) * scale.x); y[2] = ImGui_ImplSoft_ToFixed((v2->pos.y - off.y) * scale.y);
+
+    // Dear ImGui emits both windings: make the triangle counter-clockwise so edge functions are positive inside
+    ImS64 area = (ImS64)(x[1] - x[0]) * (y[2] - y[0]) - (ImS64)(y[1] - y[0]) * (x[2] - x[0]);
+    if (area == 0)
+        return false;
+    if (area < 0)
+    {
+        const ImDrawVert* tv = v1; v1 = v2; v2 = tv;
+        int t = x[1]; x[1] = x[2]; x[2] = t;
+        t = y[1]; y[1] = y[2]; y[2] = t;
+        area = -area;
+    }
+
+    // Bounding box (conservative, the edge functions decide on exact coverage)
+    int min_x = ImGui_ImplSoft_Min(x[0], ImGui_ImplSoft_Min(x[1], x[2])), max_x = ImGui_ImplSoft_Max(x[0], ImGui_ImplSoft_Max(x[1], x[2]));
+    int min_y = ImGui_ImplSoft_Min(y[0], ImGui_ImplSoft_Min(y[1], y[2])), max_y = ImGui_ImplSoft_Max(y[0], ImGui_ImplSoft_Max(y[1], y[2]));
+    prim.MinX = ImGui_ImplSoft_FloorDiv(min_x, IMGUI_IMPL_SOFT_SUBPIXEL_ONE);
+    prim.MinY = ImGui_ImplSoft_FloorDiv(min_y, IMGUI_IMPL_SOFT_SUBPIXEL_ONE);
+    prim.MaxX = ImGui_ImplSoft_FloorDiv(max_x, IMGUI_IMPL_SOFT_SUBPIXEL_ONE) + 1;
+    prim.MaxY = ImGui_ImplSoft_FloorDiv(max_y, IMGUI_IMPL_SOFT_SUBPIXEL_ONE) + 1;
+
+    // Edge n goes from vertex n+1 to vertex n+2. Top-left rule: pixels exactly on a right or bottom edge are not drawn.
+    for (int n = 0; n < 3; n++)
+    {
+        const int i = (n + 1) % 3, j = (n + 2) % 3;
+        const int a = y[i] - y[j];
+        const int b = x[j] - x[i];
+        const bool is_top_left = (a > 0) || (a == 0 && b > 0);
+        prim.A[n] = a;
+        prim.B[n] = b;
+        prim.C[n] = -((ImS64)a * x[i] + (ImS64)b * y[i]) - (is_top_left ? 0 : 1);
+    }
+    const float inv_area = (float)IMGUI_IMPL_SOFT_SUBPIXEL_ONE / (float)area;
+    prim.V0 = ImVec2((float)x[0] / IMGUI_IMPL_SOFT_SUBPIXEL_ONE, (float)y[0] / IMGUI_IMPL_SOFT_SUBPIXEL_ONE);
+    prim.L1Grad = ImVec2((float)prim.A[1] * inv_area, (float)prim.B[1] * inv_area);
+    prim.L2Grad = ImVec2((float)prim.A[2] * inv_area, (float)prim.B[2] * inv_area);
+
+    prim.IsRect = false;
+    prim.UniformCol = (v0->col == v1->col && v0->col == v2->col);
+    prim.UniformUV = (v0->uv.x == v1->uv.x && v0->uv.x == v2->uv.x && v0->uv.y == v1->uv.y && v0->uv.y == v2->uv.y);
+    prim.Col = v0->col;
+    prim.Uv0 = v0->uv;
+    prim.UvD1 = ImVec2(v1->uv.x - v0->uv.x, v1->uv.y - v0->uv.y);
+    prim.UvD2 = ImVec2(v2->uv.x - v0->uv.x, v2->uv.y - v0->uv.y);
+    if (!prim.UniformCol)
+    {
+        ImVec4 c0 = ImGui_ImplSoft_UnpackColor(v0->col), c1 = ImGui_ImplSoft_UnpackColor(v1->col), c2 = ImGui_ImplSoft_UnpackColor(v2->col);
+        prim.Col0 = c0;
+        prim.ColD1 = ImVec4(c1.x - c0.x, c1.y - c0.y, c1.z - c0.z, c1.w - c0.w);
+        prim.ColD2 = ImVec4(c2.x - c0.x, c2.y - c0.y, c2.z - c0.z, c2.w - c0.w);
+    }
+    return true;
+}
+
+// Detect the 2 triangles written by ImDrawList::PrimRect()/PrimRectUV(): indices (a, a+1, a+2, a, a+2, a+3) forming an axis aligned rectangle with axis aligned UV and a single color.
+static bool ImGui_ImplSoft_SetupRect(ImGui_ImplSoft_Prim& prim, const ImDrawVert* vtx, const ImDrawIdx* idx, const ImVec2& off, const ImVec2& scale)
+{
+    const unsigned int a = idx[0];
+    if (idx[1] != a + 1 || idx[2] != a + 2 || idx[3] != a || idx[4] != a + 2 || idx[5] != a + 3)
+        return false;
+    const ImDrawVert& p0 = vtx[a + 0];
+    const ImDrawVert& p1 = vtx[a + 1];
+    const ImDrawVert& p2 = vtx[a + 2];
+    const ImDrawVert& p3 = vtx[a + 3];
+    if (p0.col != p1.col || p0.col != p2.col || p0.col != p3.col)
+        return false;
+    if (p0.pos.y != p1.pos.y || p1.pos.x != p2.pos.x || p2.pos.y != p3.pos.y || p3.pos.x != p0.pos.x)
+        return false;
+    if (p0.uv.y != p1.uv.y || p1.uv.x != p2.uv.x || p2.uv.y != p3.uv.y || p3.uv.x != p0.uv.x)
+        return false;
+    if (!(p0.pos.x < p2.pos.x && p0.pos.y < p2.pos.y))
+        return false;
+
+    // Pixel (x,y) is covered when its center is inside [x0,x1)x[y0,y1), which is what the top-left rule gives for the two triangles.
+    const int x0 = ImGui_ImplSoft_ToFixed((p0.pos.x - off.x) * scale.x), y0 = ImGui_ImplSoft_ToFixed((p0.pos.y - off.y) * scale.y);
+    const int x1 = ImGui_ImplSoft_ToFixed((p2.pos.x - off.x) * scale.x), y1 = ImGui_ImplSoft_ToFixed((p2.pos.y - off.y) * scale.y);
+    const int half = IMGUI_IMPL_SOFT_SUBPIXEL_ONE / 2;
+    prim.MinX = -ImGui_ImplSoft_FloorDiv(-(x0 - half), IMGUI_IMPL_SOFT_SUBPIXEL_ONE);
+    prim.MinY = -ImGui_ImplSoft_FloorDiv(-(y0 - half), IMGUI_IMPL_SOFT_SUBPIXEL_ONE);
+    prim.MaxX = -ImGui_ImplSoft_FloorDiv(-(x1 - half), IMGUI_IMPL_SOFT_SUBPIXEL_ONE);
+    prim.MaxY = -ImGui_ImplSoft_FloorDiv(-(y1 - half), IMGUI_IMPL_SOFT_SUBPIXEL_ONE);
+
+    // uv(px) = Uv0 + px * UvD1, with px the pixel center in framebuffer space
+    const float fx0 = (float)x0 / IMGUI_IMPL_SOFT_SUBPIXEL_ONE, fy0 = (float)y0 / IMGUI_IMPL_SOFT_SUBPIXEL_ONE;
+    const float fx1 = (float)x1 / IMGUI_IMPL_SOFT_SUBPIXEL_ONE, fy1 = (float)y1 / IMGUI_IMPL_SOFT_SUBPIXEL_ONE;
+    prim.UvD1 = ImVec2((p2.uv.x - p0.uv.x) / (fx1 - fx0), (p2.uv.y - p0.uv.y) / (fy1 - fy0));
+    prim.Uv0 = ImVec2(p0.uv.x - fx0 * prim.UvD1.x, p0.uv.y - fy0 * prim.UvD1.y);
+    prim.UvD2 = ImVec2(0.0f, 0.0f);
+
+    prim.IsRect = true;
+    prim.UniformCol = true;
+    prim.UniformUV = (p0.uv.x == p2.uv.x && p0.uv.y == p2.uv.y);
+    prim.Col = p0.col;
+    return true;
+}
+
+// Return the SdfScale of a primitive sampling the signed distance field rows of its texture, 0.0f otherwise.
+// Field distances are converted to framebuffer pixels using the texel footprint of a pixel along x, taken at the center of the primitive.
+static float ImGui_ImplSoft_SetupSdf(const ImGui_ImplSoft_Prim& prim, const ImGui_ImplSoft_Texture* tex)
+{
+    if (tex == NULL || tex->SdfMinY >= tex->SdfMaxY || prim.UniformUV)
+        return 0.0f;
+    const float cx = (float)(prim.MinX + prim.MaxX) * 0.5f, cy = (float)(prim.MinY + prim.MaxY) * 0.5f;
+    float v, du_dx, dv_dx;
+    if (prim.IsRect)
+    {
+        v = prim.Uv0.y + cy * prim.UvD1.y;
+        du_dx = prim.UvD1.x;
+        dv_dx = 0.0f;
+    }
+    else
+    {
+        const float l1 = prim.L1Grad.x * (cx - prim.V0.x) + prim.L1Grad.y * (cy - prim.V0.y);
+        const float l2 = prim.L2Grad.x * (cx - prim.V0.x) + prim.L2Grad.y * (cy - prim.V0.y);
+        v = prim.Uv0.y + l1 * prim.UvD1.y + l2 * prim.UvD2.y;
+        du_dx = prim.L1Grad.x * prim.UvD1.x + prim.L2Grad.x * prim.UvD2.x;
+        dv_dx = prim.L1Grad.x * prim.UvD1.y + prim.L2Grad.x * prim.UvD2.y;
+    }
+    const int y = (int)(v * tex->Height);
+    if (y < tex->SdfMinY || y >= tex->SdfMaxY)
+        return 0.0f;
+    const float tx = du_dx * tex->Width, ty = dv_dx * tex->Height;
+    const float texels_per_pixel_sqr = tx * tx + ty * ty;
+    if (texels_per_pixel_sqr <= 0.0f)
+        return 0.0f;
+    return tex->SdfDistScale / sqrtf(texels_per_pixel_sqr);
+}
+
+// Set up and append the primitives of an indexed triangle list
+static void ImGui_ImplSoft_AddPrims(const ImDrawVert* vtx, const ImDrawIdx* idx, const ImDrawIdx* idx_end, const ImGui_ImplSoft_DrawState& state, int state_idx, const ImVec2& clip_off, const ImVec2& clip_scale)
+{
+    while (idx < idx_end)
+    {
+        ImGui_ImplSoft_Prim prim;
+        int consumed = 3;
+        if (idx_end - idx >= 6 && ImGui_ImplSoft_SetupRect(prim, vtx, idx, clip_off, clip_scale))
+            consumed = 6;
+        else if (!ImGui_ImplSoft_SetupTriangle(prim, &vtx[idx[0]], &vtx[idx[1]], &vtx[idx[2]], clip_off, clip_scale))
+        {
+            idx += 3;
+            continue;
+        }
+        idx += consumed;
+
+        prim.MinX = ImGui_ImplSoft_Max(prim.MinX, state.ClipMinX);
+        prim.MinY = ImGui_ImplSoft_Max(prim.MinY, state.ClipMinY);
+        prim.MaxX = ImGui_ImplSoft_Min(prim.MaxX, state.ClipMaxX);
+        prim.MaxY = ImGui_ImplSoft_Min(prim.MaxY, state.ClipMaxY);
+        if (prim.MinX >= prim.MaxX || prim.MinY >= prim.MaxY)
+            continue;
+        if (prim.UniformCol && prim.UniformUV)
+            prim.Col = ImGui_ImplSoft_Modulate(prim.Col, ImGui_ImplSoft_Sample(state.Texture, prim.Uv0.x, prim.Uv0.y));
+        if (prim.UniformCol && prim.UniformUV && (prim.Col >> 24) == 0)
+            continue;
+        prim.SdfScale = ImGui_ImplSoft_SetupSdf(prim, state.Texture);
+        prim.StateIdx = state_idx;
+        prim.TileMinX = prim.MinX / IMGUI_IMPL_SOFT_TILE_SIZE;
+        prim.TileMinY = prim.MinY / IMGUI_IMPL_SOFT_TILE_SIZE;
+        prim.TileMaxX = (prim.MaxX - 1) / IMGUI_IMPL_SOFT_TILE_SIZE;
+        prim.TileMaxY = (prim.MaxY - 1) / IMGUI_IMPL_SOFT_TILE_SIZE;
+        g_Prims.push_back(prim);
+    }
+}
+
+static void ImGui_ImplSoft_BinDrawData(ImDrawData* draw_data, int fb_width, int fb_height)
+{
+    const ImVec2 clip_off = draw_data->DisplayPos;
+    const ImVec2 clip_scale = draw_data->FramebufferScale;
+    const ImDrawGlyphQuad* glyph_table = ImGui::GetIO().Fonts->GlyphTable.Data;
+    g_States.resize(0);
+    g_Prims.resize(0);
+
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != NULL)
+            {
+                // User callback, registered via ImDrawList::AddCallback()
+                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+                // Callbacks are invoked while binning: they cannot draw into the framebuffer in submission order.
+                if (pcmd->UserCallback != ImDrawCallback_ResetRenderState)
+                    pcmd->UserCallback(cmd_list, pcmd);
+                continue;
+            }
+
+            // Project scissor/clipping rectangles into framebuffer space
+            ImGui_ImplSoft_DrawState state;
+            state.ClipMinX = ImGui_ImplSoft_Max((int)((pcmd->ClipRect.x - clip_off.x) * clip_scale.x), 0);
+            state.ClipMinY = ImGui_ImplSoft_Max((int)((pcmd->ClipRect.y - clip_off.y) * clip_scale.y), 0);
+            state.ClipMaxX = ImGui_ImplSoft_Min((int)((pcmd->ClipRect.z - clip_off.x) * clip_scale.x), fb_width);
+            state.ClipMaxY = ImGui_ImplSoft_Min((int)((pcmd->ClipRect.w - clip_off.y) * clip_scale.y), fb_height);
+            if (state.ClipMinX >= state.ClipMaxX || state.ClipMinY >= state.ClipMaxY)
+                continue;
+            state.Texture = (const ImGui_ImplSoft_Texture*)pcmd->TextureId;
+            const int state_idx = g_States.Size;
+            g_States.push_back(state);
+
+            const ImDrawVert* vtx = cmd_list->VtxBuffer.Data + pcmd->VtxOffset;
+            const ImDrawIdx* idx = cmd_list->IdxBuffer.Data + pcmd->IdxOffset;
+            ImGui_ImplSoft_AddPrims(vtx, idx, idx + pcmd->ElemCount, state, state_idx, clip_off, clip_scale);
+
+            // Glyph instances are expanded into the same quad ImFont::RenderText() would have output, after the triangles of the command
+            static const ImDrawIdx quad_idx[6] = { 0, 1, 2, 0, 2, 3 };
+            const ImDrawGlyph* glyph = cmd_list->GlyphBuffer.Data + pcmd->GlyphOffset;
+            for (unsigned int glyph_n = 0; glyph_n < pcmd->GlyphCount; glyph_n++, glyph++)
+            {
+                const ImDrawGlyphQuad& quad = glyph_table[glyph->GlyphIndex];
+                const float x1 = glyph->Pos.x + quad.X0 * glyph->Scale;
+                const float x2 = glyph->Pos.x + quad.X1 * glyph->Scale;
+                const float y1 = glyph->Pos.y + quad.Y0 * glyph->Scale;
+                const float y2 = glyph->Pos.y + quad.Y1 * glyph->Scale;
+                ImDrawVert quad_vtx[4];
+                quad_vtx[0].pos.x = x1; quad_vtx[0].pos.y = y1; quad_vtx[0].col = glyph->Col; quad_vtx[0].uv.x = quad.U0; quad_vtx[0].uv.y = quad.V0;
+                quad_vtx[1].pos.x = x2; quad_vtx[1].pos.y = y1; quad_vtx[1].col = glyph->Col; quad_vtx[1].uv.x = quad.U1; quad_vtx[1].uv.y = quad.V0;
+                quad_vtx[2].pos.x = x2; quad_vtx[2].pos.y = y2; quad_vtx[2].col = glyph->Col; quad_vtx[2].uv.x = quad.U1; quad_vtx[2].uv.y = quad.V1;
+                quad_vtx[3].pos.x = x1; quad_vtx[3].pos.y = y2; quad_vtx[3].col = glyph->Col; quad_vtx[3].uv.x = quad.U0; quad_vtx[3].uv.y = quad.V1;
+                ImGui_ImplSoft_AddPrims(quad_vtx, quad_idx, quad_idx + 6, state, state_idx, clip_off, clip_scale);
+            }
+        }
+    }
+
+    // Bin primitives into tiles (count, prefix sum, fill), preserving submission order within each tile
+    const int tiles_count = g_JobTilesX * g_JobTilesY;
+    g_TileBinOffsets.resize(tiles_count + 1);
+    memset(g_TileBinOffsets.Data, 0, (size_t)g_TileBinOffsets.size_in_bytes());
+    for (int prim_n = 0; prim_n < g_Prims.Size; prim_n++)
+    {
+        const ImGui_ImplSoft_Prim& prim = g_Prims[prim_n];
+        for (int ty = prim.TileMinY; ty <= prim.TileMaxY; ty++)
+            for (int tx = prim.TileMinX; tx <= prim.TileMaxX; tx++)
+                g_TileBinOffsets[ty * g_JobTilesX + tx + 1]++;
+    }
+    for (int tile_n = 0; tile_n < tiles_count; tile_n++)
+        g_TileBinOffsets[tile_n + 1] += g_TileBinOffsets[tile_n];
+    g_TileBinPrims.resize(g_TileBinOffsets[tiles_count]);
+    g_TileBinCursor.resize(tiles_count);
+    memcpy(g_TileBinCursor.Data, g_TileBinOffsets.Data, (size_t)tiles_count * sizeof(int));
+    for (int prim_n = 0; prim_n < g_Prims.Size; prim_n++)
+    {
+        const ImGui_ImplSoft_Prim& prim = g_Prims[prim_n];
+        for (int ty = prim.TileMinY; ty <= prim.TileMaxY; ty++)
+            for (int tx = prim.TileMinX; tx <= prim.TileMaxX; tx++)
+                g_TileBinPrims[g_TileBinCursor[ty * g_JobTilesX + tx]++] = prim_n;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Rasterization
+//-----------------------------------------------------------------------------
+
+static inline void ImGui_ImplSoft_ShadeTrianglePixel(ImU32* row, int x, int y, const ImGui_ImplSoft_Prim& prim, const ImGui_ImplSoft_Texture* tex)
+{
+    ImU32* dst = &row[x];
+    if (prim.UniformCol && prim.UniformUV)
+    {
+        *dst = ImGui_ImplSoft_Blend(*dst, prim.Col);
+        return;
+    }
+    const float dx = (float)x + 0.5f - prim.V0.x;
+    const float dy = (float)y + 0.5f - prim.V0.y;
+    const float l1 = prim.L1Grad.x * dx + prim.L1Grad.y * dy;
+    const float l2 = prim.L2Grad.x * dx + prim.L2Grad.y * dy;
+    ImU32 col = prim.Col;
+    if (!prim.UniformCol)
+        col = ImGui_ImplSoft_PackColor(ImVec4(
+            prim.Col0.x + l1 * prim.ColD1.x + l2 * prim.ColD2.x,
+            prim.Col0.y + l1 * prim.ColD1.y + l2 * prim.ColD2.y,
+            prim.Col0.z + l1 * prim.ColD1.z + l2 * prim.ColD2.z,
+            prim.Col0.w + l1 * prim.ColD1.w + l2 * prim.ColD2.w));
+    if (prim.UniformUV)
+        col = ImGui_ImplSoft_Modulate(col, ImGui_ImplSoft_Sample(tex, prim.Uv0.x, prim.Uv0.y));
+    else if (prim.SdfScale > 0.0f)
+        col = ImGui_ImplSoft_Modulate(col, ImGui_ImplSoft_ShadeSdf(tex, prim.SdfScale, prim.Uv0.x + l1 * prim.UvD1.x + l2 * prim.UvD2.x, prim.Uv0.y + l1 * prim.UvD1.y + l2 * prim.UvD2.y));
+    else
+        col = ImGui_ImplSoft_Modulate(col, ImGui_ImplSoft_Sample(tex, prim.Uv0.x + l1 * prim.UvD1.x + l2 * prim.UvD2.x, prim.Uv0.y + l1 * prim.UvD1.y + l2 * prim.UvD2.y));
+    *dst = ImGui_ImplSoft_Blend(*dst, col);
+}
+
+// Fill a span with a constant color, blending 4 pixels per iteration with SSE2
+static void ImGui_ImplSoft_FillSpan(ImU32* dst, int count, ImU32 col)
+{
+    const ImU32 sa = col >> 24;
+    if (sa == 0xFF)
+    {
+        for (int n = 0; n < count; n++)
+            dst[n] = col;
+        return;
+    }
+    int n = 0;
+#ifdef IMGUI_IMPL_SOFT_USE_SSE2
+    // Per 16-bit lane: out = (src_term + dst * (255 - sa)) / 255, with src_term = src * sa for color channels and 255 * sa for alpha.
+    // This is the same arithmetic as ImGui_ImplSoft_Blend() so both paths give identical results.
+    const __m128i zero = _mm_setzero_si128();
+    const ImU32 src_rgb_a = (col & 0x00FFFFFF) | 0xFF000000;
+    const __m128i src16 = _mm_unpacklo_epi8(_mm_set1_epi32((int)src_rgb_a), zero);
+    const __m128i src_term = _mm_add_epi16(_mm_mullo_epi16(src16, _mm_set1_epi16((short)sa)), _mm_set1_epi16(0x80));
+    const __m128i inv_sa = _mm_set1_epi16((short)(255 - sa));
+    for (; n + 4 <= count; n += 4)
+    {
+        const __m128i d = _mm_loadu_si128((const __m128i*)(dst + n));
+        __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), inv_sa), src_term);
+        __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), inv_sa), src_term);
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+        _mm_storeu_si128((__m128i*)(dst + n), _mm_packus_epi16(lo, hi));
+    }
+#endif
+    for (; n < count; n++)
+        dst[n] = ImGui_ImplSoft_Blend(dst[n], col);
+}
+
+// Rasterize a triangle one row at a time. The covered span of each row is solved exactly from the fixed point edge functions,
+// so no per-pixel inside test is needed (this matters for the long thin triangles produced by fans, e.g. rounded window backgrounds).
+static void ImGui_ImplSoft_RasterizeTriangle(const ImGui_ImplSoft_Prim& prim, const ImGui_ImplSoft_Texture* tex, int x0, int y0, int x1, int y1)
+{
+    const int one = IMGUI_IMPL_SOFT_SUBPIXEL_ONE;
+    const bool uniform = prim.UniformCol && prim.UniformUV;
+    for (int y = y0; y < y1; y++)
+    {
+        const ImS64 px = (ImS64)x0 * one + one / 2;
+        const ImS64 py = (ImS64)y * one + one / 2;
+        int span_x0 = x0, span_x1 = x1;
+        for (int n = 0; n < 3 && span_x0 < span_x1; n++)
+        {
+            // E(x) = e + step * (x - x0) must be >= 0
+            const ImS64 e = prim.A[n] * px + prim.B[n] * py + prim.C[n];
+            const ImS64 step = (ImS64)prim.A[n] * one;
+            if (step > 0)
+            {
+                if (e < 0)
+                    span_x0 = ImGui_ImplSoft_Max(span_x0, x0 + (int)((-e + step - 1) / step));
+            }
+            else if (step < 0)
+            {
+                if (e < 0)
+                    span_x1 = span_x0;
+                else
+                    span_x1 = ImGui_ImplSoft_Min(span_x1, x0 + (int)(e / -step) + 1);
+            }
+            else if (e < 0)
+            {
+                span_x1 = span_x0;
+            }
+        }
+        if (span_x0 >= span_x1)
+            continue;
+
+        ImU32* row = g_JobFramebuffer + (size_t)y * g_JobStride;
+        if (uniform)
+            ImGui_ImplSoft_FillSpan(row + span_x0, span_x1 - span_x0, prim.Col);
+        else
+            for (int x = span_x0; x < span_x1; x++)
+                ImGui_ImplSoft_ShadeTrianglePixel(row, x, y, prim, tex);
+    }
+}
+
+static void ImGui_ImplSoft_RasterizeRect(const ImGui_ImplSoft_Prim& prim, const ImGui_ImplSoft_Texture* tex, int x0, int y0, int x1, int y1)
+{
+    if (prim.UniformUV)
+    {
+        // Solid fill (frames, backgrounds, everything using the white pixel)
+        for (int y = y0; y < y1; y++)
+            ImGui_ImplSoft_FillSpan(g_JobFramebuffer + (size_t)y * g_JobStride + x0, x1 - x0, prim.Col);
+        return;
+    }
+
+    // Signed distance field glyph
+    if (prim.SdfScale > 0.0f)
+    {
+        for (int y = y0; y < y1; y++)
+        {
+            ImU32* row = g_JobFramebuffer + (size_t)y * g_JobStride;
+            const float v = prim.Uv0.y + ((float)y + 0.5f) * prim.UvD1.y;
+            float u = prim.Uv0.x + ((float)x0 + 0.5f) * prim.UvD1.x;
+            for (int x = x0; x < x1; x++, u += prim.UvD1.x)
+            {
+                const ImU32 texel = ImGui_ImplSoft_ShadeSdf(tex, prim.SdfScale, u, v);
+                if (texel != 0)
+                    row[x] = ImGui_ImplSoft_Blend(row[x], ImGui_ImplSoft_Modulate(prim.Col, texel));
+            }
+        }
+        return;
+    }
+
+    // Textured rectangle (glyphs, images): uv is linear along each axis
+    for (int y = y0; y < y1; y++)
+    {
+        ImU32* row = g_JobFramebuffer + (size_t)y * g_JobStride;
+        const float v = prim.Uv0.y + ((float)y + 0.5f) * prim.UvD1.y;
+        float u = prim.Uv0.x + ((float)x0 + 0.5f) * prim.UvD1.x;
+        for (int x = x0; x < x1; x++, u += prim.UvD1.x)
+        {
+            const ImU32 texel = ImGui_ImplSoft_Sample(tex, u, v);
+            if ((texel >> 24) != 0)
+                row[x] = ImGui_ImplSoft_Blend(row[x], ImGui_ImplSoft_Modulate(prim.Col, texel));
+        }
+    }
+}
+
+static void ImGui_ImplSoft_RasterizeTile(int tile_n)
+{
+    const int tile_x0 = (tile_n % g_JobTilesX) * IMGUI_IMPL_SOFT_TILE_SIZE;
+    const int tile_y0 = (tile_n / g_JobTilesX) * IMGUI_IMPL_SOFT_TILE_SIZE;
+    const int tile_x1 = ImGui_ImplSoft_Min(tile_x0 + IMGUI_IMPL_SOFT_TILE_SIZE, g_JobWidth);
+    const int tile_y1 = ImGui_ImplSoft_Min(tile_y0 + IMGUI_IMPL_SOFT_TILE_SIZE, g_JobHeight);
+    for (int bin_n = g_TileBinOffsets[tile_n]; bin_n < g_TileBinOffsets[tile_n + 1]; bin_n++)
+    {
+        const ImGui_ImplSoft_Prim& prim = g_Prims[g_TileBinPrims[bin_n]];
+        const ImGui_ImplSoft_Texture* tex = g_States[prim.StateIdx].Texture;
+        const int x0 = ImGui_ImplSoft_Max(prim.MinX, tile_x0), y0 = ImGui_ImplSoft_Max(prim.MinY, tile_y0);
+        const int x1 = ImGui_ImplSoft_Min(prim.MaxX, tile_x1), y1 = ImGui_ImplSoft_Min(prim.MaxY, tile_y1);
+        if (x0 >= x1 || y0 >= y1)
+            continue;
+        if (prim.IsRect)
+            ImGui_ImplSoft_RasterizeRect(prim, tex, x0, y0, x1, y1);
+        else
+            ImGui_ImplSoft_RasterizeTriangle(prim, tex, x0, y0, x1, y1);
+    }
+}
+
+static void ImGui_ImplSoft_RasterizeTiles()
+{
+    const int tiles_count = g_JobTilesX * g_JobTilesY;
+    for (int tile_n = g_NextTile.fetch_add(1); tile_n < tiles_count; tile_n = g_NextTile.fetch_add(1))
+        ImGui_ImplSoft_RasterizeTile(tile_n);
+}
+
+//-----------------------------------------------------------------------------
+// Thread pool
+//-----------------------------------------------------------------------------
+
+static void ImGui_ImplSoft_WorkerMain()
+{
+    unsigned int seen_generation = 0;
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(g_WorkersMutex);
+            g_WorkersWakeCond.wait(lock, [&] { return g_WorkersQuit || g_WorkersGeneration != seen_generation; });
+            if (g_WorkersQuit)
+                return;
+            seen_generation = g_WorkersGeneration;
+        }
+        ImGui_ImplSoft_RasterizeTiles();
+        {
+            std::lock_guard<std::mutex> lock(g_WorkersMutex);
+            if (--g_WorkersBusy == 0)
+                g_WorkersDoneCond.notify_one();
+        }
+    }
+}
+
+static void ImGui_ImplSoft_DestroyWorkers()
+{
+    if (g_Workers == NULL)
+        return;
+    {
+        std::lock_guard<std::mutex> lock(g_WorkersMutex);
+        g_WorkersQuit = true;
+    }
+    g_WorkersWakeCond.notify_all();
+    for (int n = 0; n < g_WorkersCount; n++)
+        g_Workers[n].join();
+    delete[] g_Workers;
+    g_Workers = NULL;
+    g_WorkersCount = 0;
+    g_WorkersQuit = false;
+}
+
+void    ImGui_ImplSoft_SetThreadCount(int thread_count)
+{
+    if (thread_count <= 0)
+        thread_count = (int)std::thread::hardware_concurrency();
+    if (thread_count <= 0)
+        thread_count = 1;
+    if (g_Workers != NULL && g_WorkersCount == thread_count - 1)
+        return;
+    ImGui_ImplSoft_DestroyWorkers();
+    g_ThreadCount = thread_count;
+    g_WorkersCount = thread_count - 1;
+    g_WorkersGeneration = 0;
+    if (g_WorkersCount > 0)
+    {
+        g_Workers = new std::thread[g_WorkersCount];
+        for (int n = 0; n < g_WorkersCount; n++)
+            g_Workers[n] = std::thread(ImGui_ImplSoft_WorkerMain);
+    }
+}
+
+int     ImGui_ImplSoft_GetThreadCount()
+{
+    return g_ThreadCount;
+}
+
+// Copy the regions of the font atlas modified since the last frame (see ImFontConfig::GlyphsOnDemand, ImFontAtlas::BuildAppend)
+static void ImGui_ImplSoft_UpdateFontsTexture()
+{
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    if (atlas->TexDirtyRects.Size == 0)
+        return;
+    if (g_FontTextureCreated && atlas->TexPixelsRGBA32 != NULL && atlas->TexWidth == g_FontTexture.Width && atlas->TexHeight == g_FontTexture.Height)
+    {
+        for (int n = 0; n < atlas->TexDirtyRects.Size; n++)
+        {
+            const ImFontAtlasTexRect& r = atlas->TexDirtyRects[n];
+            for (int y = r.Y; y < r.Y + r.H; y++)
+                memcpy(&g_FontPixels[y * g_FontTexture.Width + r.X], atlas->TexPixelsRGBA32 + y * atlas->TexWidth + r.X, (size_t)r.W * sizeof(ImU32));
+        }
+    }
+    atlas->TexDirtyRects.resize(0);
+}
+
+//-----------------------------------------------------------------------------
+// Public API
+//-----------------------------------------------------------------------------
+
+void    ImGui_ImplSoft_RenderDrawData(ImDrawData* draw_data, ImU32* framebuffer, int width, int height, int stride)
+{
+    // Avoid rendering when minimized
+    if (draw_data->DisplaySize.x <= 0.0f || draw_data->DisplaySize.y <= 0.0f || framebuffer == NULL || width <= 0 || height <= 0)
+        return;
+
+    ImGui_ImplSoft_UpdateFontsTexture();
+
+    g_JobFramebuffer = framebuffer;
+    g_JobWidth = width;
+    g_JobHeight = height;
+    g_JobStride = stride;
+    g_JobTilesX = (width + IMGUI_IMPL_SOFT_TILE_SIZE - 1) / IMGUI_IMPL_SOFT_TILE_SIZE;
+    g_JobTilesY = (height + IMGUI_IMPL_SOFT_TILE_SIZE - 1) / IMGUI_IMPL_SOFT_TILE_SIZE;
+    ImGui_ImplSoft_BinDrawData(draw_data, width, height);
+    if (g_Prims.Size == 0)
+        return;
+
+    // Rasterize tiles on every thread, including this one
+    g_NextTile.store(0);
+    if (g_WorkersCount > 0)
+    {
+        {
+            std::lock_guard<std::mutex> lock(g_WorkersMutex);
+            g_WorkersBusy = g_WorkersCount;
+            g_WorkersGeneration++;
+        }
+        g_WorkersWakeCond.notify_all();
+    }
+    ImGui_ImplSoft_RasterizeTiles();
+    if (g_WorkersCount > 0)
+    {
+        std::unique_lock<std::mutex> lock(g_WorkersMutex);
+        g_WorkersDoneCond.wait(lock, [] { return g_WorkersBusy == 0; });
+    }
+}
+
+bool    ImGui_ImplSoft_CreateDeviceObjects()
+{
+    if (g_FontTextureCreated)
+        ImGui_ImplSoft_InvalidateDeviceObjects();
+
+    // Build texture atlas. Keep our own copy of the pixels, like a GPU texture: the atlas may free them (ClearTexData) or reallocate them (Build).
+    ImGuiIO& io = ImGui::GetIO();
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    g_FontPixels.resize(width * height);
+    memcpy(g_FontPixels.Data, pixels, (size_t)g_FontPixels.size_in_bytes());
+    io.Fonts->TexDirtyRects.resize(0);
+    g_FontTexture.Pixels = g_FontPixels.Data;
+    g_FontTexture.Width = width;
+    g_FontTexture.Height = height;
+    g_FontTexture.SdfMinY = io.Fonts->TexSdfMinY;
+    g_FontTexture.SdfMaxY = io.Fonts->TexSdfMaxY;
+    g_FontTexture.SdfOnEdge = (float)io.Fonts->SdfOnEdgeValue;
+    g_FontTexture.SdfDistScale = (float)io.Fonts->SdfPadding / (float)io.Fonts->SdfOnEdgeValue;
+    g_FontTextureCreated = true;
+
+    // Store our identifier
+    io.Fonts->TexID = (ImTextureID)&g_FontTexture;
+    return true;
+}
+
+void    ImGui_ImplSoft_InvalidateDeviceObjects()
+{
+    if (!g_FontTextureCreated)
+        return;
+    g_FontTexture = ImGui_ImplSoft_Texture();
+    g_FontPixels.clear();
+    g_FontTextureCreated = false;
+    ImGui::GetIO().Fonts->TexID = NULL;
+}
+
+bool    ImGui_ImplSoft_Init(int thread_count)
+{
+    // Setup back-end capabilities flags
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendRendererName = "imgui_impl_soft";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;      // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasGlyphInstances; // We can expand the ImDrawCmd::GlyphOffset/GlyphCount glyph instances.
+
+    ImGui_ImplSoft_SetThreadCount(thread_count);
+    return ImGui_ImplSoft_CreateDeviceObjects();
+}
+
+void    ImGui_ImplSoft_Shutdown()
+{
+    ImGui_ImplSoft_InvalidateDeviceObjects();
+    ImGui_ImplSoft_DestroyWorkers();
+    g_States.clear();
+    g_Prims.clear();
+    g_TileBinOffsets.clear();
+    g_TileBinPrims.clear();
+    g_TileBinCursor.clear();
+}
+
+void    ImGui_ImplSoft_NewFrame()
+{
+    if (!g_FontTextureCreated)
+        ImGui_ImplSoft_CreateDeviceObjects();
+}
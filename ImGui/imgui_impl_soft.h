@@ -0,0 +1,43 @@
+// dear imgui: Renderer for software rasterization into a CPU framebuffer (no GPU required)
+// This needs to be used along with a Platform Binding (e.g. Win32, or the headless Null binding)
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoft_Texture*' as ImTextureID. Read the FAQ about ImTextureID!
+//  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Multi-threaded. Triangles are binned into screen tiles, tiles are rasterized in parallel on a thread pool.
+//  [X] Renderer: Signed distance field glyphs (ImFontConfig::SignedDistanceField) stay sharp at any scale.
+//  [X] Renderer: Glyph instances (ImGuiBackendFlags_RendererHasGlyphInstances), when io.ConfigRenderGlyphInstances is set.
+// Missing features:
+//  [ ] Renderer: Textures are point sampled. Dear ImGui output is pixel aligned so text and shapes match a GPU, but scaled user images will look blocky.
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+
+// Texture as seen by the software renderer. Pass a pointer to one of those as ImTextureID.
+struct ImGui_ImplSoft_Texture
+{
+    const ImU32*    Pixels;         // RGBA32 pixels, packed the same way as IM_COL32() (Width * Height elements)
+    int             Width;
+    int             Height;
+    int             SdfMinY;        // Rows [SdfMinY, SdfMaxY) hold signed distance fields in their alpha channel (see ImFontAtlas::TexSdfMinY). They are bilinear filtered and shaded as coverage.
+    int             SdfMaxY;
+    float           SdfOnEdge;      // = ImFontAtlas::SdfOnEdgeValue
+    float           SdfDistScale;   // = ImFontAtlas::SdfPadding / ImFontAtlas::SdfOnEdgeValue: distance in texels per unit of alpha
+
+    ImGui_ImplSoft_Texture()        { Pixels = NULL; Width = Height = 0; SdfMinY = SdfMaxY = 0; SdfOnEdge = SdfDistScale = 0.0f; }
+};
+
+// Framebuffer pixels are RGBA32 packed the same way as IM_COL32(). 'stride' is expressed in pixels.
+// The renderer blends into the existing content: clear the framebuffer yourself beforehand.
+IMGUI_IMPL_API bool     ImGui_ImplSoft_Init(int thread_count = 0);      // thread_count: total number of rasterizing threads including the caller's. 0: one per hardware thread.
+IMGUI_IMPL_API void     ImGui_ImplSoft_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplSoft_NewFrame();
+IMGUI_IMPL_API void     ImGui_ImplSoft_RenderDrawData(ImDrawData* draw_data, ImU32* framebuffer, int width, int height, int stride);
+
+// Change the size of the thread pool (same semantic as for ImGui_ImplSoft_Init). Don't call while rendering.
+IMGUI_IMPL_API void     ImGui_ImplSoft_SetThreadCount(int thread_count);
+IMGUI_IMPL_API int      ImGui_ImplSoft_GetThreadCount();
+
+// Use if you want to reset your rendering device without losing Dear ImGui state.
+IMGUI_IMPL_API void     ImGui_ImplSoft_InvalidateDeviceObjects();
+IMGUI_IMPL_API bool     ImGui_ImplSoft_CreateDeviceObjects();
@@ -0,0 +1,182 @@
+// dear imgui: ImGuiIO input recording and replay
+// See imgui_input_capture.h for the file format.
+
+#if defined(_MSC_VER) && !defined(_CRT_SECURE_NO_WARNINGS)
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include "imgui_input_capture.h"
+#include <string.h>     // memcpy, memset
+
+#define IMGUI_INPUT_CAPTURE_FILE_MAGIC  0x52494D49      // 'IMIR'
+#define IMGUI_INPUT_CAPTURE_VERSION     1
+#define IMGUI_INPUT_CAPTURE_BOM         0x01020304
+
+struct ImGuiInputCaptureFileHeader
+{
+    ImU32   Magic;
+    ImU32   Version;
+    ImU32   ByteOrderMark;
+    ImU32   KeysDownCount;
+    ImU32   KeyMapCount;
+};
+
+// ImGuiInputCaptureFrame::KeysDown and MouseDown store one bit per key/button
+IM_STATIC_ASSERT(IM_ARRAYSIZE(ImGuiIO::KeysDown) <= 16 * 32);
+IM_STATIC_ASSERT(IM_ARRAYSIZE(ImGuiIO::MouseDown) <= 8);
+
+//-----------------------------------------------------------------------------
+// ImGuiInputRecorder
+//-----------------------------------------------------------------------------
+
+bool ImGuiInputRecorder::Open(const char* filename)
+{
+    Close();
+    File = fopen(filename, "wb");
+    if (File == NULL)
+        return false;
+    FramesCount = 0;
+
+    const ImGuiIO& io = ImGui::GetIO();
+    ImGuiInputCaptureFileHeader header;
+    header.Magic = IMGUI_INPUT_CAPTURE_FILE_MAGIC;
+    header.Version = IMGUI_INPUT_CAPTURE_VERSION;
+    header.ByteOrderMark = IMGUI_INPUT_CAPTURE_BOM;
+    header.KeysDownCount = (ImU32)IM_ARRAYSIZE(io.KeysDown);
+    header.KeyMapCount = (ImU32)ImGuiKey_COUNT;
+    fwrite(&header, sizeof(header), 1, File);
+    fwrite(io.KeyMap, sizeof(int), ImGuiKey_COUNT, File);
+    return ferror(File) == 0;
+}
+
+bool ImGuiInputRecorder::RecordFrame(const ImGuiIO& io)
+{
+    IM_ASSERT(File != NULL && "Missing call to Open()");
+    if (File == NULL)
+        return false;
+
+    ImGuiInputCaptureFrame frame;
+    memset(&frame, 0, sizeof(frame));
+    frame.DeltaTime = io.DeltaTime;
+    frame.DisplaySize[0] = io.DisplaySize.x;
+    frame.DisplaySize[1] = io.DisplaySize.y;
+    frame.MousePos[0] = io.MousePos.x;
+    frame.MousePos[1] = io.MousePos.y;
+    frame.MouseWheel = io.MouseWheel;
+    frame.MouseWheelH = io.MouseWheelH;
+    for (int n = 0; n < IM_ARRAYSIZE(io.MouseDown); n++)
+        if (io.MouseDown[n])
+            frame.MouseDown |= (ImU8)(1 << n);
+    frame.KeyMods = (ImU8)((io.KeyCtrl ? 1 : 0) | (io.KeyShift ? 2 : 0) | (io.KeyAlt ? 4 : 0) | (io.KeySuper ? 8 : 0));
+    for (int n = 0; n < IM_ARRAYSIZE(io.KeysDown); n++)
+        if (io.KeysDown[n])
+            frame.KeysDown[n >> 5] |= (ImU32)1 << (n & 31);
+
+    const int chars_count = (io.InputQueueCharacters.Size < 0xFFFF) ? io.InputQueueCharacters.Size : 0xFFFF;
+    frame.CharsCount = (ImU16)chars_count;
+    TempChars.resize(chars_count);
+    for (int n = 0; n < chars_count; n++)
+        TempChars[n] = (ImU32)io.InputQueueCharacters[n];
+
+    fwrite(&frame, sizeof(frame), 1, File);
+    fwrite(TempChars.Data, sizeof(ImU32), (size_t)TempChars.Size, File);
+    FramesCount++;
+    return ferror(File) == 0;
+}
+
+void ImGuiInputRecorder::Close()
+{
+    if (File != NULL)
+        fclose(File);
+    File = NULL;
+    TempChars.clear();
+}
+
+//-----------------------------------------------------------------------------
+// ImGuiInputPlayer
+//-----------------------------------------------------------------------------
+
+bool ImGuiInputPlayer::Open(const char* filename)
+{
+    Clear();
+    FILE* f = fopen(filename, "rb");
+    if (f == NULL)
+        return false;
+
+    // Validate header
+    ImGuiInputCaptureFileHeader header;
+    if (fread(&header, sizeof(header), 1, f) != 1 || header.Magic != IMGUI_INPUT_CAPTURE_FILE_MAGIC || header.Version != IMGUI_INPUT_CAPTURE_VERSION ||
+        header.ByteOrderMark != IMGUI_INPUT_CAPTURE_BOM || header.KeysDownCount != (ImU32)IM_ARRAYSIZE(ImGuiIO().KeysDown) || header.KeyMapCount != (ImU32)ImGuiKey_COUNT ||
+        fread(RecordedKeyMap, sizeof(int), ImGuiKey_COUNT, f) != ImGuiKey_COUNT)
+    {
+        fclose(f);
+        Clear();
+        return false;
+    }
+
+    // Load frames. A truncated trailing frame (e.g. the recording process crashed) is ignored.
+    ImGuiInputCaptureFrame frame;
+    while (fread(&frame, sizeof(frame), 1, f) == 1)
+    {
+        const int chars_offset = Chars.Size;
+        Chars.resize(chars_offset + frame.CharsCount);
+        if (fread(Chars.Data + chars_offset, sizeof(ImU32), frame.CharsCount, f) != frame.CharsCount)
+        {
+            Chars.resize(chars_offset);
+            break;
+        }
+        Frames.push_back(frame);
+        CharsOffsets.push_back(chars_offset);
+    }
+    fclose(f);
+    return true;
+}
+
+void ImGuiInputPlayer::Clear()
+{
+    Frames.clear();
+    CharsOffsets.clear();
+    Chars.clear();
+    for (int key = 0; key < ImGuiKey_COUNT; key++)
+        RecordedKeyMap[key] = -1;
+}
+
+void ImGuiInputPlayer::ApplyFrame(int frame_index, ImGuiIO& io) const
+{
+    IM_ASSERT(frame_index >= 0 && frame_index < Frames.Size);
+    const ImGuiInputCaptureFrame& frame = Frames[frame_index];
+    io.DeltaTime = frame.DeltaTime;
+    io.DisplaySize = ImVec2(frame.DisplaySize[0], frame.DisplaySize[1]);
+    io.MousePos = ImVec2(frame.MousePos[0], frame.MousePos[1]);
+    io.MouseWheel = frame.MouseWheel;
+    io.MouseWheelH = frame.MouseWheelH;
+    for (int n = 0; n < IM_ARRAYSIZE(io.MouseDown); n++)
+        io.MouseDown[n] = (frame.MouseDown & (1 << n)) != 0;
+    io.KeyCtrl = (frame.KeyMods & 1) != 0;
+    io.KeyShift = (frame.KeyMods & 2) != 0;
+    io.KeyAlt = (frame.KeyMods & 4) != 0;
+    io.KeySuper = (frame.KeyMods & 8) != 0;
+    memset(io.KeysDown, 0, sizeof(io.KeysDown));
+    if (memcmp(RecordedKeyMap, io.KeyMap, sizeof(RecordedKeyMap)) == 0)
+    {
+        for (int n = 0; n < IM_ARRAYSIZE(io.KeysDown); n++)
+            io.KeysDown[n] = (frame.KeysDown[n >> 5] & ((ImU32)1 << (n & 31))) != 0;
+    }
+    else
+    {
+        // Different key map (e.g. recorded with the Win32 back-end, replayed with the null back-end): translate named keys only
+        for (int key = 0; key < ImGuiKey_COUNT; key++)
+        {
+            const int recorded_n = RecordedKeyMap[key], n = io.KeyMap[key];
+            if (recorded_n >= 0 && recorded_n < IM_ARRAYSIZE(io.KeysDown) && n >= 0 && n < IM_ARRAYSIZE(io.KeysDown))
+                io.KeysDown[n] = (frame.KeysDown[recorded_n >> 5] & ((ImU32)1 << (recorded_n & 31))) != 0;
+        }
+    }
+
+    io.InputQueueCharacters.resize(0);
+    const ImU32* chars = Chars.Data + CharsOffsets[frame_index];
+    for (int n = 0; n < frame.CharsCount; n++)
+        io.AddInputCharacter(chars[n]);
+}
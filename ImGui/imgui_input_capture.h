@@ -0,0 +1,61 @@
+// dear imgui: ImGuiIO input recording and replay
+// Record the inputs written into ImGuiIO by the platform back-end on every frame, and inject them later into another context.
+// This is meant to replay an interaction session (hovering, dragging sliders, typing, switching tabs) bit-exactly in a headless
+// context, to compare CPU time, allocations and draw command counts before and after a change.
+
+// File format (version 1, native endianness):
+//   Header: magic 'IMIR', u32 version, u32 byte order mark (0x01020304), u32 KeysDown count, u32 KeyMap count, i32 KeyMap[KeyMap count]
+//   Frame:  ImGuiInputCaptureFrame (see below), followed by u32 characters[CharsCount]
+// Recorded values are stored as-is, floats included, so a replayed frame sees exactly the same ImGuiIO inputs as the recorded one.
+// io.KeysDown[] is indexed by native key codes: the key map of the recording process is stored, and keys named in io.KeyMap[] are
+// translated to the key map of the replaying process. Other keys are only replayed when both key maps are identical.
+
+#pragma once
+#include "imgui.h"
+#include <stdio.h>      // FILE
+
+// Frame record as stored in the file
+struct ImGuiInputCaptureFrame
+{
+    float           DeltaTime;
+    float           DisplaySize[2];
+    float           MousePos[2];
+    float           MouseWheel;
+    float           MouseWheelH;
+    ImU8            MouseDown;          // 1 bit per io.MouseDown[] entry
+    ImU8            KeyMods;            // 1: KeyCtrl, 2: KeyShift, 4: KeyAlt, 8: KeySuper
+    ImU16           CharsCount;         // Number of u32 characters following this record (io.InputQueueCharacters)
+    ImU32           KeysDown[16];       // 1 bit per io.KeysDown[] entry
+};
+
+// Record inputs into a file
+// - Call RecordFrame() after the platform back-end NewFrame() function and before ImGui::NewFrame().
+struct ImGuiInputRecorder
+{
+    FILE*                   File;
+    int                     FramesCount;
+    ImVector<ImU32>         TempChars;
+
+    ImGuiInputRecorder()    { File = NULL; FramesCount = 0; }
+    ~ImGuiInputRecorder()   { Close(); }
+    IMGUI_API bool          Open(const char* filename);     // Store the key map of the current context
+    IMGUI_API bool          RecordFrame(const ImGuiIO& io);
+    IMGUI_API void          Close();
+};
+
+// Load a recording and inject its frames into ImGuiIO
+// - Call ApplyFrame() after the platform back-end NewFrame() function and before ImGui::NewFrame(): it overwrites io.DeltaTime and io.DisplaySize too.
+// - Keys are translated to the key map of the io passed to ApplyFrame().
+struct ImGuiInputPlayer
+{
+    ImVector<ImGuiInputCaptureFrame> Frames;
+    ImVector<int>           CharsOffsets;       // Offset of each frame's characters within Chars
+    ImVector<ImU32>         Chars;
+    int                     RecordedKeyMap[ImGuiKey_COUNT];
+
+    ImGuiInputPlayer()      { Clear(); }
+    IMGUI_API bool          Open(const char* filename);
+    IMGUI_API void          Clear();
+    int                     GetFramesCount() const { return Frames.Size; }
+    IMGUI_API void          ApplyFrame(int frame_index, ImGuiIO& io) const;
+};
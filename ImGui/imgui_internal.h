@@ -88,7 +88,9 @@ Index of this file:
 struct ImBitVector;                 // Store 1-bit per value
 struct ImRect;                      // An axis-aligned rectangle (2 points)
 struct ImDrawDataBuilder;           // Helper to build a ImDrawData instance
+struct ImGuiAllocStats;             // Allocation counters of a subsystem or a window (IMGUI_ENABLE_ALLOC_TRACKING)
 struct ImDrawListSharedData;        // Data shared between all ImDrawList instances
+struct ImDrawListShapeTemplate;     // Precomputed geometry of a filled unit shape
 struct ImGuiColorMod;               // Stacked color modifier, backup of modified data so we can restore it
 struct ImGuiColumnData;             // Storage data for a single column
 struct ImGuiColumns;                // Storage data for a columns set
@@ -221,6 +223,13 @@ namespace ImStb
 #endif
 #endif // #ifndef IM_DEBUG_BREAK
 
+// Account the allocations made until the end of the current scope to a subsystem (see IMGUI_ENABLE_ALLOC_TRACKING in imconfig.h)
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+#define IM_ALLOC_TAG_SCOPE(_TAG)        ImGuiAllocTagScope alloc_tag_scope(_TAG)
+#else
+#define IM_ALLOC_TAG_SCOPE(_TAG)        ((void)0)
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] Generic helpers
 // Note that the ImXXX helpers functions are lower-level than ImGui functions.
@@ -241,11 +250,15 @@ namespace ImStb
 // - Helper: ImBitVector
 // - Helper: ImPool<>
 // - Helper: ImChunkStream<>
+// - Helper: ImGuiFrameArena, ImFrameVector<>
 //-----------------------------------------------------------------------------
 
 // Helpers: Hashing
 IMGUI_API ImU32         ImHashData(const void* data, size_t data_size, ImU32 seed = 0);
 IMGUI_API ImU32         ImHashStr(const char* data, size_t data_size = 0, ImU32 seed = 0);
+#ifdef IMGUI_HAS_CONSTEXPR_LABEL
+IMGUI_API ImU32         ImHashLabel(const ImGuiLabel& label, ImU32 seed = 0);  // == ImHashStr(label.Label, 0, seed)
+#endif
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
 static inline ImU32     ImHash(const void* data, int size, ImU32 seed = 0) { return size ? ImHashData(data, (size_t)size, seed) : ImHashStr((const char*)data, 0, seed); } // [moved to ImHashStr/ImHashData in 1.68]
 #endif
@@ -282,6 +295,58 @@ IMGUI_API int           ImParseFormatPrecision(const char* format, int default_v
 static inline bool      ImCharIsBlankA(char c)          { return c == ' ' || c == '\t'; }
 static inline bool      ImCharIsBlankW(unsigned int c)  { return c == ' ' || c == '\t' || c == 0x3000; }
 
+// Helpers: Text scanning (used by the ASCII fast paths of ImFont::CalcTextSizeA(), ImFont::CalcWordWrapPositionA() and FindRenderedTextEnd())
+// Classify 16 bytes at once with SSE2 when available. Runs are measured up to 'str_end' only: no byte past it is read.
+#if (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)) && !defined(IMGUI_DISABLE_SSE)
+#define IMGUI_TEXT_USE_SSE2
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>     // _BitScanForward
+static inline int       ImCountTrailingZeros(unsigned int mask) { unsigned long n; _BitScanForward(&n, mask); return (int)n; }  // mask != 0
+#else
+static inline int       ImCountTrailingZeros(unsigned int mask) { return __builtin_ctz(mask); }                                     // mask != 0
+#endif
+#endif
+static inline bool      ImCharIsPlainA(char c)          { return (unsigned char)c >= 0x20 && (unsigned char)c < 0x80; }   // Printable ASCII: a single byte character with no special handling in text layout
+static inline bool      ImCharIsWordA(char c)           { return ImCharIsPlainA(c) && c != ' ' && c != '.' && c != ',' && c != ';' && c != '!' && c != '?' && c != '\"'; } // Printable ASCII which doesn't end a word for word-wrapping
+static inline int       ImTextCountPlainA(const char* str, const char* str_end)
+{
+    const char* s = str;
+#ifdef IMGUI_TEXT_USE_SSE2
+    const __m128i lower = _mm_set1_epi8(0x1F);
+    for (; str_end - s >= 16; s += 16)
+    {
+        // Signed compare: bytes >= 0x80 are negative
+        const unsigned int stop_mask = ~(unsigned int)_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_loadu_si128((const __m128i*)(const void*)s), lower)) & 0xFFFF;
+        if (stop_mask != 0)
+            return (int)(s - str) + ImCountTrailingZeros(stop_mask);
+    }
+#endif
+    while (s < str_end && ImCharIsPlainA(*s))
+        s++;
+    return (int)(s - str);
+}
+static inline int       ImTextCountWordA(const char* str, const char* str_end)
+{
+    const char* s = str;
+#ifdef IMGUI_TEXT_USE_SSE2
+    const __m128i lower = _mm_set1_epi8(0x20);
+    for (; str_end - s >= 16; s += 16)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(const void*)s);
+        __m128i punct = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('.')), _mm_cmpeq_epi8(v, _mm_set1_epi8(',')));
+        punct = _mm_or_si128(punct, _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(';')), _mm_cmpeq_epi8(v, _mm_set1_epi8('!'))));
+        punct = _mm_or_si128(punct, _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('?')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\"'))));
+        const unsigned int stop_mask = (unsigned int)_mm_movemask_epi8(_mm_andnot_si128(_mm_cmpgt_epi8(v, lower), _mm_set1_epi8(-1))) | (unsigned int)_mm_movemask_epi8(punct);
+        if (stop_mask != 0)
+            return (int)(s - str) + ImCountTrailingZeros(stop_mask);
+    }
+#endif
+    while (s < str_end && ImCharIsWordA(*s))
+        s++;
+    return (int)(s - str);
+}
+
 // Helpers: UTF-8 <> wchar conversions
 IMGUI_API int           ImTextStrToUtf8(char* buf, int buf_size, const ImWchar* in_text, const ImWchar* in_text_end);      // return output UTF-8 bytes count
 IMGUI_API int           ImTextCharFromUtf8(unsigned int* out_char, const char* in_text, const char* in_text_end);          // read one character. return input UTF-8 bytes count
@@ -525,6 +590,92 @@ struct IMGUI_API ImChunkStream
     T*      ptr_from_offset(int off)    { IM_ASSERT(off >= 4 && off < Buf.Size); return (T*)(void*)(Buf.Data + off); }
 };
 
+// Helper: ImGuiFrameArena
+// Linear allocator for transient data rebuilt every frame, which is never freed individually.
+// Memory allocated during a frame stays valid until the end of the following frame (ImDrawData::CmdLists is read by the Metrics window
+// during the next frame), so we alternate between two buffers and Reset() recycles the one used by the frame before last.
+// Allocations which don't fit are served by the heap, then the buffer is grown to the size needed when it gets recycled:
+// after a few frames of warm-up, frames with a steady workload don't allocate anything.
+struct IMGUI_API ImGuiFrameArena
+{
+    struct Buffer
+    {
+        char*           Data;
+        int             Capacity;
+        int             Size;                   // Bytes used in Data
+        int             OverflowSize;           // Bytes allocated from the heap because Data was full
+        ImVector<void*> OverflowBlocks;
+
+        Buffer()        { Data = NULL; Capacity = Size = OverflowSize = 0; }
+    };
+    Buffer  Buffers[2];
+    int     Epoch;                              // Incremented by Reset() at the beginning of every frame. Current buffer is Buffers[Epoch & 1].
+
+    ImGuiFrameArena()   { Epoch = 0; }
+    ~ImGuiFrameArena()  { ClearFreeMemory(); }
+    void*   Alloc(size_t sz);
+    void    Reset();
+    void    ClearFreeMemory();
+    int     GetFrameUsage(int frames_ago = 0) const { const Buffer& buf = Buffers[(Epoch - frames_ago) & 1]; return buf.Size + buf.OverflowSize; }
+    int     GetCapacity() const                     { return Buffers[0].Capacity + Buffers[1].Capacity; }
+};
+
+// Helper: ImFrameVector<>
+// Subset of ImVector<> allocating from an ImGuiFrameArena, for containers which are emptied every frame. Memory is never freed.
+// Contents of the previous frame can still be read, and are moved to the memory of the current frame on the first write.
+// Contents older than that are lost (Reset() may have freed or reallocated the buffer): a vector which may not have been used during the
+// previous frame needs to be reset with resize(0). Accessors assert on such stale contents.
+template<typename T>
+struct ImFrameVector
+{
+    int                 Size;
+    int                 Capacity;
+    T*                  Data;
+    int                 Epoch;                  // Arena epoch when Data was allocated
+    ImGuiFrameArena*    Arena;
+
+    typedef T                   value_type;
+    typedef value_type*         iterator;
+    typedef const value_type*   const_iterator;
+
+    ImFrameVector()                             { Size = Capacity = Epoch = 0; Data = NULL; Arena = NULL; }
+
+    bool                empty() const           { return Size == 0; }
+    int                 size() const            { return Size; }
+    int                 size_in_bytes() const   { return Size * (int)sizeof(T); }
+    T&                  operator[](int i)       { IM_ASSERT(i < Size && (Epoch + 1 >= Arena->Epoch)); return Data[i]; }
+    const T&            operator[](int i) const { IM_ASSERT(i < Size && (Epoch + 1 >= Arena->Epoch)); return Data[i]; }
+
+    void                clear()                 { Size = Capacity = 0; Data = NULL; }
+    T*                  begin()                 { IM_ASSERT(Size == 0 || Epoch + 1 >= Arena->Epoch); return Data; }
+    const T*            begin() const           { IM_ASSERT(Size == 0 || Epoch + 1 >= Arena->Epoch); return Data; }
+    T*                  end()                   { return Data + Size; }
+    const T*            end() const             { return Data + Size; }
+    T&                  back()                  { IM_ASSERT(Size > 0 && (Epoch + 1 >= Arena->Epoch)); return Data[Size - 1]; }
+    const T&            back() const            { IM_ASSERT(Size > 0 && (Epoch + 1 >= Arena->Epoch)); return Data[Size - 1]; }
+    void                swap(ImFrameVector<T>& rhs) { ImFrameVector<T> tmp = rhs; rhs = *this; *this = tmp; }
+
+    int                 _grow_capacity(int sz) const { int new_capacity = Capacity ? (Capacity + Capacity / 2) : 8; return new_capacity > sz ? new_capacity : sz; }
+    void                resize(int new_size)    { if (new_size == 0 && Epoch != Arena->Epoch) clear(); else if (new_size > Capacity || Epoch != Arena->Epoch) reserve(_grow_capacity(new_size)); Size = new_size; }
+    void                reserve(int new_capacity)
+    {
+        if (new_capacity <= Capacity && Epoch == Arena->Epoch)
+            return;
+        if (new_capacity < Size)
+            new_capacity = Size;
+        IM_ASSERT((Size == 0 || Epoch + 1 == Arena->Epoch || Epoch == Arena->Epoch) && "Contents of the frame before last were recycled. Call resize(0) first.");
+        T* new_data = (T*)Arena->Alloc((size_t)new_capacity * sizeof(T));
+        if (Size > 0)
+            memcpy(new_data, Data, (size_t)Size * sizeof(T));
+        Data = new_data;
+        Capacity = new_capacity;
+        Epoch = Arena->Epoch;
+    }
+
+    void                push_back(const T& v)   { if (Size == Capacity || Epoch != Arena->Epoch) reserve(_grow_capacity(Size + 1)); memcpy(&Data[Size], &v, sizeof(v)); Size++; }
+    void                pop_back()              { IM_ASSERT(Size > 0); Size--; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImDrawList support
 //-----------------------------------------------------------------------------
@@ -539,6 +690,17 @@ struct IMGUI_API ImChunkStream
 #define IM_DRAWLIST_ARCFAST_TESSELLATION_MULTIPLIER             1
 #endif
 
+// Precomputed geometry of a filled unit shape (circle or rounded rectangle), scaled and translated into the vertex buffer by
+// AddCircleFilled() and AddRectFilled(). Each point is 'Anchors[PointsAnchor[n]] + Points[n] * radius'.
+// The anti-aliasing normals only depend on the directions of the edges, so they are shared by all sizes of a given shape.
+struct ImDrawListShapeTemplate
+{
+    ImVector<ImVec2>    Points;         // Unit offset of each point from its anchor
+    ImVector<ImU8>      PointsAnchor;   // Anchor of each point: 0 for circles, corner index (top-left, top-right, bottom-right, bottom-left) for rectangles
+    ImVector<ImVec2>    FringeOffsets;  // Anti-aliased shapes only: offset of the outer fringe vertex of each point (the inner one is mirrored)
+    ImVector<ImDrawIdx> Indices;        // Relative to the first vertex of the shape
+};
+
 // Data shared between all ImDrawList instances
 // You may want to create your own instance of this if you want to use ImDrawList completely without ImGui. In that case, watch out for future changes to this structure.
 struct IMGUI_API ImDrawListSharedData
@@ -556,17 +718,25 @@ struct IMGUI_API ImDrawListSharedData
     ImU8            CircleSegmentCounts[64];    // Precomputed segment count for given radius (array index + 1) before we calculate it dynamically (to avoid calculation overhead)
     const ImVec4*   TexUvLines;                 // UV of anti-aliased lines in the atlas
 
+    // [Internal] Temporary write buffer, e.g. normals in AddPolyline(). Draw lists sharing this data must be built from a single thread.
+    mutable ImVector<ImVec2> TempBuffer;
+    mutable ImPool<ImDrawListShapeTemplate> ShapeTemplates; // Built on first use, same threading restriction as TempBuffer
+
     ImDrawListSharedData();
     void SetCircleSegmentMaxError(float max_error);
+    const ImDrawListShapeTemplate* GetCircleTemplate(int num_segments, bool anti_aliased) const;
+    const ImDrawListShapeTemplate* GetRoundedRectTemplate(ImDrawCornerFlags rounding_corners, bool anti_aliased) const;
 };
 
 struct ImDrawDataBuilder
 {
-    ImVector<ImDrawList*>   Layers[2];           // Global layers for: regular, tooltip
+    ImFrameVector<ImDrawList*> Layers[2];        // Global layers for: regular, tooltip. Allocated from ImGuiContext::FrameArena.
+    ImVector<ImDrawList*>   MergedLists;         // Draw lists owned by the builder, filled by MergeDrawLists() (io.ConfigRenderMergeDrawLists)
 
     void Clear()            { for (int n = 0; n < IM_ARRAYSIZE(Layers); n++) Layers[n].resize(0); }
-    void ClearFreeMemory()  { for (int n = 0; n < IM_ARRAYSIZE(Layers); n++) Layers[n].clear(); }
+    void ClearFreeMemory()  { for (int n = 0; n < IM_ARRAYSIZE(Layers); n++) Layers[n].clear(); for (int n = 0; n < MergedLists.Size; n++) IM_DELETE(MergedLists[n]); MergedLists.clear(); }
     IMGUI_API void FlattenIntoSingleLayer();
+    IMGUI_API void MergeDrawLists(ImDrawListSharedData* shared_data);
 };
 
 //-----------------------------------------------------------------------------
@@ -781,6 +951,18 @@ enum ImGuiPopupPositionPolicy
     ImGuiPopupPositionPolicy_Tooltip
 };
 
+// Subsystem an allocation is accounted to (IMGUI_ENABLE_ALLOC_TRACKING), set with IM_ALLOC_TAG_SCOPE()
+enum ImGuiAllocTag
+{
+    ImGuiAllocTag_Other,
+    ImGuiAllocTag_DrawList,         // ImDrawList commands, vertices, indices, glyph instances, channels
+    ImGuiAllocTag_Storage,          // ImGuiStorage pairs and hash index
+    ImGuiAllocTag_TextBuffer,       // ImGuiTextBuffer (logging, .ini settings, user buffers)
+    ImGuiAllocTag_FontAtlas,        // ImFontAtlas fonts, glyphs, texture, on-demand glyphs
+    ImGuiAllocTag_InputText,        // InputText() state, text and undo buffers
+    ImGuiAllocTag_COUNT
+};
+
 struct ImGuiDataTypeTempStorage
 {
     ImU8        Data[8];        // Can fit any data up to ImGuiDataType_COUNT
@@ -803,6 +985,25 @@ enum ImGuiDataTypePrivate_
     ImGuiDataType_ID
 };
 
+// Allocation counters of a subsystem or a window (IMGUI_ENABLE_ALLOC_TRACKING)
+// Frees are accounted to the context, subsystem and window of the allocation, when made while that context is current.
+struct ImGuiAllocStats
+{
+    int         LiveCount;              // Blocks currently allocated
+    size_t      LiveBytes;              // Bytes currently allocated
+    size_t      PeakBytes;              // High-water mark of LiveBytes
+    int         FrameAllocCount;        // Allocations made since the beginning of the current frame
+    size_t      FrameAllocBytes;
+    int         LastFrameAllocCount;    // Allocations made during the previous frame
+    size_t      LastFrameAllocBytes;
+    int         TotalAllocCount;
+
+    ImGuiAllocStats()               { memset(this, 0, sizeof(*this)); }
+    void        OnAlloc(size_t sz)  { LiveCount++; LiveBytes += sz; PeakBytes = ImMax(PeakBytes, LiveBytes); FrameAllocCount++; FrameAllocBytes += sz; TotalAllocCount++; }
+    void        OnFree(size_t sz)   { LiveCount--; LiveBytes -= sz; }
+    void        NewFrame()          { LastFrameAllocCount = FrameAllocCount; LastFrameAllocBytes = FrameAllocBytes; FrameAllocCount = 0; FrameAllocBytes = 0; }
+};
+
 // Stacked color modifier, backup of modified data so we can restore it
 struct ImGuiColorMod
 {
@@ -981,6 +1182,46 @@ struct ImGuiPtrOrIndex
     ImGuiPtrOrIndex(int index)  { Ptr = NULL; Index = index; }
 };
 
+// Sizes returned by CalcTextSize(), so labels submitted every frame are only measured once.
+// Open addressing with linear probing. Entries not used during the current or previous frame are stale: insertions reuse their slots,
+// and they are dropped when a table filled at more than 3/4 is rehashed. The whole table is cleared when the font atlas is rebuilt.
+// Texts are compared by length and 64-bit hash, then by content: a copy of each text is kept in TextBuffer, which is compacted on rehash.
+#define IM_TEXT_SIZE_CACHE_MIN_CAPACITY     256
+#define IM_TEXT_SIZE_CACHE_MIN_TEXT_WASTE   4096    // Rehash when the texts of replaced entries use more than this and more than the texts of current entries
+
+struct ImGuiTextSizeCacheEntry
+{
+    ImFont*     Font;               // NULL for an empty slot
+    float       FontSize;
+    float       WrapWidth;
+    ImU64       TextHash;           // Hash of the displayed text, seeded with the other fields
+    int         TextOffset;         // Copy of the displayed text in ImGuiTextSizeCache::TextBuffer
+    int         TextLength;
+    int         LastUsedFrame;
+    ImVec2      Size;
+
+    ImGuiTextSizeCacheEntry()       { memset(this, 0, sizeof(*this)); }
+};
+
+struct ImGuiTextSizeCache
+{
+    ImVector<ImGuiTextSizeCacheEntry> Entries;  // Capacity is a power of two, or zero
+    ImVector<char> TextBuffer;      // Texts of the entries, not zero-terminated
+    int         UsedCount;          // Non-empty slots, including stale ones
+    int         UsedTextBytes;      // Bytes of TextBuffer referenced by non-empty slots. The others belong to replaced entries.
+    int         FrameCount;         // Copy of g.FrameCount, set by NewFrame()
+    ImFontAtlas* Atlas;             // Atlas and ImFontAtlas::BuildGeneration the sizes were computed with
+    int         AtlasBuildGeneration;
+    bool        Enabled;            // = true
+    int         HitsCount;          // Stats
+    int         MissesCount;        // Stats
+
+    ImGuiTextSizeCache()            { UsedCount = UsedTextBytes = FrameCount = AtlasBuildGeneration = 0; Atlas = NULL; Enabled = true; HitsCount = MissesCount = 0; }
+    void        Clear()             { Entries.clear(); TextBuffer.clear(); UsedCount = UsedTextBytes = 0; }
+    IMGUI_API ImGuiTextSizeCacheEntry* GetOrAddEntry(ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end, bool* p_found); // When *p_found is false, the caller writes Size
+    IMGUI_API void  Rehash();       // Drop stale entries, compact TextBuffer and resize to twice the live entries
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Columns support
 //-----------------------------------------------------------------------------
@@ -1127,7 +1368,7 @@ struct ImGuiContext
     // Windows state
     ImVector<ImGuiWindow*>  Windows;                            // Windows, sorted in display order, back to front
     ImVector<ImGuiWindow*>  WindowsFocusOrder;                  // Windows, sorted in focus order, back to front. (FIXME: We could only store root windows here! Need to sort out the Docking equivalent which is RootWindowDockStop and is unfortunately a little more dynamic)
-    ImVector<ImGuiWindow*>  WindowsTempSortBuffer;              // Temporary buffer used in EndFrame() to reorder windows so parents are kept before their child
+    ImFrameVector<ImGuiWindow*> WindowsTempSortBuffer;          // Temporary buffer used in EndFrame() to reorder windows so parents are kept before their child
     ImVector<ImGuiWindow*>  CurrentWindowStack;
     ImGuiStorage            WindowsById;                        // Map window's ImGuiID to ImGuiWindow*
     int                     WindowsActiveCount;                 // Number of unique windows submitted by frame
@@ -1240,6 +1481,7 @@ struct ImGuiContext
     // Render
     ImDrawData              DrawData;                           // Main ImDrawData instance to pass render information to the user
     ImDrawDataBuilder       DrawDataBuilder;
+    ImGuiFrameArena         FrameArena;                         // Memory of transient data rebuilt every frame: DrawDataBuilder layers, WindowsTempSortBuffer, stacks of windows
     float                   DimBgRatio;                         // 0.0..1.0 animation when fading in a dimming background (for modal window and CTRL+TAB list)
     ImDrawList              BackgroundDrawList;                 // First draw list to be rendered.
     ImDrawList              ForegroundDrawList;                 // Last draw list to be rendered. This is where we the render software mouse cursor (if io.MouseDrawCursor is set) and most debug overlays.
@@ -1270,6 +1512,9 @@ struct ImGuiContext
     ImVector<ImGuiPtrOrIndex>       CurrentTabBarStack;
     ImVector<ImGuiShrinkWidthItem>  ShrinkWidthBuffer;
 
+    // Text measurement
+    ImGuiTextSizeCache      TextSizeCache;                      // Sizes returned by CalcTextSize() during the last frames
+
     // Widget state
     ImVec2                  LastValidMousePos;
     ImGuiInputTextState     InputTextState;
@@ -1316,11 +1561,21 @@ struct ImGuiContext
     // Debug Tools
     bool                    DebugItemPickerActive;              // Item picker is active (started with DebugStartItemPicker())
     ImGuiID                 DebugItemPickerBreakId;             // Will call IM_DEBUG_BREAK() when encountering this id
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+    ImGuiAllocTag           AllocTag;                           // Subsystem of the allocations made now, set with IM_ALLOC_TAG_SCOPE()
+    ImU32                   AllocContextUid;                    // Unique id stored in the header of the allocations accounted to this context
+    ImGuiAllocStats         AllocStats[ImGuiAllocTag_COUNT];    // Allocations per subsystem
+    ImGuiAllocStats         AllocStatsTotal;
+    ImVector<ImGuiWindow*>  AllocWindows;                       // Windows indexed by ImGuiWindow::AllocIdx, to account frees to the window of the allocation
+#endif
 
     // Misc
     float                   FramerateSecPerFrame[120];          // Calculate estimate of framerate for user over the last 2 seconds.
     int                     FramerateSecPerFrameIdx;
     float                   FramerateSecPerFrameAccum;
+    int                     EventWaitingSettleFrames;           // Frames left to render before GetEventWaitingTime() allows waiting. Reset when inputs change.
+    float                   EventWaitingTime;                   // Computed by EndFrame(), returned by GetEventWaitingTime()
+    float                   MaxWaitBeforeNextFrame;             // Set by SetMaxWaitBeforeNextFrame(), reset every frame
     int                     WantCaptureMouseNextFrame;          // Explicit capture via CaptureKeyboardFromApp()/CaptureMouseFromApp() sets those flags
     int                     WantCaptureKeyboardNextFrame;
     int                     WantTextInputNextFrame;
@@ -1411,6 +1666,9 @@ struct ImGuiContext
         FocusRequestNextCounterRegular = FocusRequestNextCounterTabStop = INT_MAX;
         FocusTabPressed = false;
 
+        for (int n = 0; n < IM_ARRAYSIZE(DrawDataBuilder.Layers); n++)
+            DrawDataBuilder.Layers[n].Arena = &FrameArena;
+        WindowsTempSortBuffer.Arena = &FrameArena;
         DimBgRatio = 0.0f;
         BackgroundDrawList._OwnerName = "##Background"; // Give it a name for debugging
         ForegroundDrawList._OwnerName = "##Foreground"; // Give it a name for debugging
@@ -1459,15 +1717,33 @@ struct ImGuiContext
 
         DebugItemPickerActive = false;
         DebugItemPickerBreakId = 0;
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+        AllocTag = ImGuiAllocTag_Other;
+        AllocContextUid = 0;
+#endif
 
         memset(FramerateSecPerFrame, 0, sizeof(FramerateSecPerFrame));
         FramerateSecPerFrameIdx = 0;
         FramerateSecPerFrameAccum = 0.0f;
+        EventWaitingSettleFrames = 0;
+        EventWaitingTime = 0.0f;
+        MaxWaitBeforeNextFrame = FLT_MAX;
         WantCaptureMouseNextFrame = WantCaptureKeyboardNextFrame = WantTextInputNextFrame = -1;
         memset(TempBuffer, 0, sizeof(TempBuffer));
     }
 };
 
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+// Helper for IM_ALLOC_TAG_SCOPE(): set the subsystem of the allocations made until the end of the scope (innermost scope wins)
+struct ImGuiAllocTagScope
+{
+    ImGuiContext*   Ctx;
+    ImGuiAllocTag   BackupTag;
+    ImGuiAllocTagScope(ImGuiAllocTag tag)   { Ctx = GImGui; BackupTag = ImGuiAllocTag_Other; if (Ctx) { BackupTag = Ctx->AllocTag; Ctx->AllocTag = tag; } }
+    ~ImGuiAllocTagScope()                   { if (Ctx) Ctx->AllocTag = BackupTag; }
+};
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiWindowTempData, ImGuiWindow
 //-----------------------------------------------------------------------------
@@ -1523,10 +1799,10 @@ struct IMGUI_API ImGuiWindowTempData
     ImGuiItemFlags          ItemFlags;              // == ItemFlagsStack.back() [empty == ImGuiItemFlags_Default]
     float                   ItemWidth;              // == ItemWidthStack.back(). 0.0: default, >0.0: width in pixels, <0.0: align xx pixels to the right of window
     float                   TextWrapPos;            // == TextWrapPosStack.back() [empty == -1.0f]
-    ImVector<ImGuiItemFlags>ItemFlagsStack;
-    ImVector<float>         ItemWidthStack;
-    ImVector<float>         TextWrapPosStack;
-    ImVector<ImGuiGroupData>GroupStack;
+    ImFrameVector<ImGuiItemFlags> ItemFlagsStack;   // Stacks are allocated from ImGuiContext::FrameArena and reset by the first Begin() of the frame
+    ImFrameVector<float>    ItemWidthStack;
+    ImFrameVector<float>    TextWrapPosStack;
+    ImFrameVector<ImGuiGroupData> GroupStack;
     short                   StackSizesBackup[6];    // Store size of various stacks for asserting
 
     ImGuiWindowTempData()
@@ -1653,6 +1929,10 @@ struct IMGUI_API ImGuiWindow
     bool                    MemoryCompacted;                    // Set when window extraneous data have been garbage collected
     int                     MemoryDrawListIdxCapacity;          // Backup of last idx/vtx count, so when waking up the window we can preallocate and avoid iterative alloc/copy
     int                     MemoryDrawListVtxCapacity;
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+    int                     AllocIdx;                           // Index in g.AllocWindows
+    ImGuiAllocStats         AllocStats;                         // Allocations made while this window was the current window
+#endif
 
 public:
     ImGuiWindow(ImGuiContext* context, const char* name);
@@ -1665,6 +1945,9 @@ public:
     ImGuiID     GetIDNoKeepAlive(const void* ptr);
     ImGuiID     GetIDNoKeepAlive(int n);
     ImGuiID     GetIDFromRectangle(const ImRect& r_abs);
+#ifdef IMGUI_HAS_CONSTEXPR_LABEL
+    ImGuiID     GetID(const ImGuiLabel& label);
+#endif
 
     // We don't use g.FontSize because the window may be != g.CurrentWidow.
     ImRect      Rect() const            { return ImRect(Pos.x, Pos.y, Pos.x + Size.x, Pos.y + Size.y); }
@@ -1943,6 +2226,7 @@ namespace ImGui
     IMGUI_API void          TabBarQueueReorder(ImGuiTabBar* tab_bar, const ImGuiTabItem* tab, int dir);
     IMGUI_API bool          TabBarProcessReorder(ImGuiTabBar* tab_bar);
     IMGUI_API bool          TabItemEx(ImGuiTabBar* tab_bar, const char* label, bool* p_open, ImGuiTabItemFlags flags);
+    IMGUI_API bool          TabItemEx(ImGuiTabBar* tab_bar, const char* label, ImGuiID id, bool* p_open, ImGuiTabItemFlags flags);
     IMGUI_API ImVec2        TabItemCalcSize(const char* label, bool has_close_button);
     IMGUI_API void          TabItemBackground(ImDrawList* draw_list, const ImRect& bb, ImGuiTabItemFlags flags, ImU32 col);
     IMGUI_API bool          TabItemLabelAndCloseButton(ImDrawList* draw_list, const ImRect& bb, ImGuiTabItemFlags flags, ImVec2 frame_padding, const char* label, ImGuiID tab_id, ImGuiID close_button_id, bool is_contents_visible);
@@ -1980,6 +2264,8 @@ namespace ImGui
     // Widgets
     IMGUI_API void          TextEx(const char* text, const char* text_end = NULL, ImGuiTextFlags flags = 0);
     IMGUI_API bool          ButtonEx(const char* label, const ImVec2& size_arg = ImVec2(0, 0), ImGuiButtonFlags flags = 0);
+    IMGUI_API bool          ButtonEx(const char* label, ImGuiID id, const ImVec2& size_arg, ImGuiButtonFlags flags);
+    IMGUI_API bool          CheckboxEx(const char* label, ImGuiID id, bool* v);
     IMGUI_API bool          CloseButton(ImGuiID id, const ImVec2& pos);
     IMGUI_API bool          CollapseButton(ImGuiID id, const ImVec2& pos);
     IMGUI_API bool          ArrowButtonEx(const char* str_id, ImGuiDir dir, ImVec2 size_arg, ImGuiButtonFlags flags = 0);
@@ -2043,6 +2329,9 @@ namespace ImGui
     // Debug Tools
     inline void             DebugDrawItemRect(ImU32 col = IM_COL32(255,0,0,255))    { ImGuiContext& g = *GImGui; ImGuiWindow* window = g.CurrentWindow; GetForegroundDrawList(window)->AddRect(window->DC.LastItemRect.Min, window->DC.LastItemRect.Max, col); }
     inline void             DebugStartItemPicker()                                  { ImGuiContext& g = *GImGui; g.DebugItemPickerActive = true; }
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+    IMGUI_API const char*   DebugGetAllocTagName(ImGuiAllocTag tag);
+#endif
 
 } // namespace ImGui
 
@@ -2056,6 +2345,50 @@ IMGUI_API void              ImFontAtlasBuildRender1bppRectFromString(ImFontAtlas
 IMGUI_API void              ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_multiply_factor);
 IMGUI_API void              ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride);
 
+// On-demand glyphs (see ImFontConfig::GlyphsOnDemand)
+// Pages are filled with a shelf packer: a glyph goes to the lowest shelf tall enough for it, or opens a new shelf below the last one.
+// Pages are only reclaimed as a whole, so there is no fragmentation to manage and eviction only needs to scan the pages.
+#define IM_FONT_DYNAMIC_PAGE_SHELVES_MAX    32
+#define IM_FONT_DYNAMIC_GLYPH_NOT_LOADED    0xFFFF  // Value of ImFont::DynamicGlyphsPage[]
+#define IM_FONT_DYNAMIC_GLYPH_EMPTY         0xFFFE  // Value of ImFont::DynamicGlyphsPage[]
+
+struct ImFontAtlasDynamicSource;    // Font info of an ImFontConfig with GlyphsOnDemand (defined in imgui_draw.cpp)
+
+struct ImFontAtlasDynamicShelf
+{
+    unsigned short  Y, H;               // Position and height within the page
+    unsigned short  X;                  // Next free position within the shelf
+};
+
+struct ImFontAtlasDynamicPage
+{
+    int             X, Y;               // Position in atlas
+    int             LastUsedFrame;      // Value of ImFontAtlasDynamicGlyphs::FrameCount the last time one of its glyphs was looked up, -1 if never
+    int             GlyphsCount;
+    int             ShelvesCount;
+    ImFontAtlasDynamicShelf Shelves[IM_FONT_DYNAMIC_PAGE_SHELVES_MAX];
+};
+
+struct ImFontAtlasDynamicGlyphs
+{
+    ImVector<ImFontAtlasDynamicSource> Sources;
+    ImVector<ImFontAtlasDynamicPage> Pages;
+    int             PageSize;
+    int             FrameCount;         // Incremented by ImGui::NewFrame(). A page used during the current frame is never evicted.
+    int             LoadsCount;         // Stats: glyphs rasterized
+    int             EvictionsCount;     // Stats: pages reclaimed
+    int             DeferredCount;      // Stats: glyphs drawn blank because every page was full and used during the current frame
+
+    ImFontAtlasDynamicGlyphs()          { PageSize = FrameCount = 0; LoadsCount = EvictionsCount = DeferredCount = 0; }
+};
+
+IMGUI_API void              ImFontAtlasDynamicGlyphsNewFrame(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasDynamicGlyphsDestroy(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasAddTexDirtyRect(ImFontAtlas* atlas, int x, int y, int w, int h);
+
+// Glyph instances (see ImGuiBackendFlags_RendererHasGlyphInstances)
+IMGUI_API void              ImFontAtlasUpdateGlyphTable(ImFontAtlas* atlas);   // Rebuild ImFontAtlas::GlyphTable if BuildGeneration changed. Called by ImGui::NewFrame().
+
 //-----------------------------------------------------------------------------
 // [SECTION] Test Engine Hooks (imgui_test_engine)
 //-----------------------------------------------------------------------------
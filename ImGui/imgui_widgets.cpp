@@ -654,6 +654,14 @@ bool ImGui::ButtonBehavior(const ImRect& bb, ImGuiID id, bool* out_hovered, bool
 }
 
 bool ImGui::ButtonEx(const char* label, const ImVec2& size_arg, ImGuiButtonFlags flags)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    return ButtonEx(label, window->GetID(label), size_arg, flags);
+}
+
+bool ImGui::ButtonEx(const char* label, ImGuiID id, const ImVec2& size_arg, ImGuiButtonFlags flags)
 {
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
@@ -661,7 +669,6 @@ bool ImGui::ButtonEx(const char* label, const ImVec2& size_arg, ImGuiButtonFlags
 
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
-    const ImGuiID id = window->GetID(label);
     const ImVec2 label_size = CalcTextSize(label, NULL, true);
 
     ImVec2 pos = window->DC.CursorPos;
@@ -698,6 +705,16 @@ bool ImGui::Button(const char* label, const ImVec2& size_arg)
     return ButtonEx(label, size_arg, ImGuiButtonFlags_None);
 }
 
+#ifdef IMGUI_HAS_CONSTEXPR_LABEL
+bool ImGui::Button(const ImGuiLabel& label, const ImVec2& size_arg)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    return ButtonEx(label.Label, window->GetID(label), size_arg, ImGuiButtonFlags_None);
+}
+#endif
+
 // Small buttons fits within text without additional vertical spacing.
 bool ImGui::SmallButton(const char* label)
 {
@@ -1042,6 +1059,24 @@ bool ImGui::ImageButton(ImTextureID user_texture_id, const ImVec2& size, const I
 }
 
 bool ImGui::Checkbox(const char* label, bool* v)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    return CheckboxEx(label, window->GetID(label), v);
+}
+
+#ifdef IMGUI_HAS_CONSTEXPR_LABEL
+bool ImGui::Checkbox(const ImGuiLabel& label, bool* v)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    return CheckboxEx(label.Label, window->GetID(label), v);
+}
+#endif
+
+bool ImGui::CheckboxEx(const char* label, ImGuiID id, bool* v)
 {
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
@@ -1049,7 +1084,6 @@ bool ImGui::Checkbox(const char* label, bool* v)
 
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
-    const ImGuiID id = window->GetID(label);
     const ImVec2 label_size = CalcTextSize(label, NULL, true);
 
     const float square_sz = GetFrameHeight();
@@ -3786,6 +3820,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
         return false;
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_InputText);
 
     IM_ASSERT(buf != NULL && buf_size >= 0);
     IM_ASSERT(!((flags & ImGuiInputTextFlags_CallbackHistory) && (flags & ImGuiInputTextFlags_Multiline)));        // Can't use both together (they both use up/down keys)
@@ -6822,6 +6857,10 @@ namespace ImGui
 {
     static void             TabBarLayout(ImGuiTabBar* tab_bar);
     static ImU32            TabBarCalcTabID(ImGuiTabBar* tab_bar, const char* label);
+#ifdef IMGUI_HAS_CONSTEXPR_LABEL
+    static ImU32            TabBarCalcTabID(ImGuiTabBar* tab_bar, const ImGuiLabel& label);
+#endif
+    static bool             BeginTabItemEx(ImGuiTabBar* tab_bar, const char* label, ImGuiID id, bool* p_open, ImGuiTabItemFlags flags);
     static float            TabBarCalcMaxTabWidth();
     static float            TabBarScrollClamp(ImGuiTabBar* tab_bar, float scrolling);
     static void             TabBarScrollToTab(ImGuiTabBar* tab_bar, ImGuiTabItem* tab, ImGuiTabBarSection* sections);
@@ -7222,6 +7261,23 @@ static ImU32   ImGui::TabBarCalcTabID(ImGuiTabBar* tab_bar, const char* label)
     }
 }
 
+#ifdef IMGUI_HAS_CONSTEXPR_LABEL
+static ImU32   ImGui::TabBarCalcTabID(ImGuiTabBar* tab_bar, const ImGuiLabel& label)
+{
+    if (tab_bar->Flags & ImGuiTabBarFlags_DockNode)
+    {
+        ImGuiID id = ImHashLabel(label);
+        KeepAliveID(id);
+        return id;
+    }
+    else
+    {
+        ImGuiWindow* window = GImGui->CurrentWindow;
+        return window->GetID(label);
+    }
+}
+#endif
+
 static float ImGui::TabBarCalcMaxTabWidth()
 {
     ImGuiContext& g = *GImGui;
@@ -7445,6 +7501,7 @@ static ImGuiTabItem* ImGui::TabBarTabListPopupButton(ImGuiTabBar* tab_bar)
 // [SECTION] Widgets: BeginTabItem, EndTabItem, etc.
 //-------------------------------------------------------------------------
 // - BeginTabItem()
+// - BeginTabItemEx() [Internal]
 // - EndTabItem()
 // - TabItemButton()
 // - TabItemEx() [Internal]
@@ -7467,9 +7524,32 @@ bool    ImGui::BeginTabItem(const char* label, bool* p_open, ImGuiTabItemFlags f
         IM_ASSERT_USER_ERROR(tab_bar, "Needs to be called between BeginTabBar() and EndTabBar()!");
         return false;
     }
+    return BeginTabItemEx(tab_bar, label, TabBarCalcTabID(tab_bar, label), p_open, flags);
+}
+
+#ifdef IMGUI_HAS_CONSTEXPR_LABEL
+bool    ImGui::BeginTabItem(const ImGuiLabel& label, bool* p_open, ImGuiTabItemFlags flags)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    if (window->SkipItems)
+        return false;
+
+    ImGuiTabBar* tab_bar = g.CurrentTabBar;
+    if (tab_bar == NULL)
+    {
+        IM_ASSERT_USER_ERROR(tab_bar, "Needs to be called between BeginTabBar() and EndTabBar()!");
+        return false;
+    }
+    return BeginTabItemEx(tab_bar, label.Label, TabBarCalcTabID(tab_bar, label), p_open, flags);
+}
+#endif
+
+static bool ImGui::BeginTabItemEx(ImGuiTabBar* tab_bar, const char* label, ImGuiID id, bool* p_open, ImGuiTabItemFlags flags)
+{
     IM_ASSERT(!(flags & ImGuiTabItemFlags_Button)); // BeginTabItem() Can't be used with button flags, use TabItemButton() instead!
 
-    bool ret = TabItemEx(tab_bar, label, p_open, flags);
+    bool ret = TabItemEx(tab_bar, label, id, p_open, flags);
     if (ret && !(flags & ImGuiTabItemFlags_NoPushId))
     {
         ImGuiTabItem* tab = &tab_bar->Tabs[tab_bar->LastTabItemIdx];
@@ -7513,7 +7593,13 @@ bool    ImGui::TabItemButton(const char* label, ImGuiTabItemFlags flags)
     return TabItemEx(tab_bar, label, NULL, flags | ImGuiTabItemFlags_Button | ImGuiTabItemFlags_NoReorder);
 }
 
+// Computing the ID keeps it alive: callers should only do it when the window isn't skipping items.
 bool    ImGui::TabItemEx(ImGuiTabBar* tab_bar, const char* label, bool* p_open, ImGuiTabItemFlags flags)
+{
+    return TabItemEx(tab_bar, label, TabBarCalcTabID(tab_bar, label), p_open, flags);
+}
+
+bool    ImGui::TabItemEx(ImGuiTabBar* tab_bar, const char* label, ImGuiID id, bool* p_open, ImGuiTabItemFlags flags)
 {
     // Layout whole tab bar if not already done
     if (tab_bar->WantLayout)
@@ -7525,7 +7611,6 @@ bool    ImGui::TabItemEx(ImGuiTabBar* tab_bar, const char* label, bool* p_open,
         return false;
 
     const ImGuiStyle& style = g.Style;
-    const ImGuiID id = TabBarCalcTabID(tab_bar, label);
 
     // If the user called us with *p_open == false, we early out and don't render.
     // We make a call to ItemAdd() so that attempts to use a contextual popup menu with an implicit ID won't use an older ID.
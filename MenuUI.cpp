@@ -0,0 +1,351 @@
+#define _CRT_SECURE_NO_WARNINGS
+
+#include "ImGui/imgui.h"
+#include <stdio.h>
+#include "MenuUI.h"
+#include "variables.h"
+
+void SetupMenuStyle()
+{
+	////YouGame Start Style
+	ImGuiStyle* style = &ImGui::GetStyle();
+	style->WindowTitleAlign = ImVec2(0.5f, 0.5f);
+	style->WindowBorderSize = 0.0f;
+	style->FramePadding = ImVec2(39.f, 6.f);
+	style->WindowPadding = ImVec2(10.f, 6.f);
+	style->GrabMinSize = 24.f;
+	style->WindowBorderSize = 0.f;
+	style->WindowMenuButtonPosition = ImGuiDir_None;
+	style->ColorButtonPosition = ImGuiDir_Left;
+	style->FrameRounding = 3.f;
+	style->GrabRounding = 4.f;
+	style->ItemSpacing = ImVec2(6.f, 6.0f);
+
+
+	style->Colors[ImGuiCol_Text] = ImVec4(1.00f, 1.00f, 1.00f, 1.00f);
+	style->Colors[ImGuiCol_TextDisabled] = ImVec4(0.50f, 0.50f, 0.50f, 1.00f);
+	style->Colors[ImGuiCol_WindowBg] = ImVec4(0.039f, 0.039f, 0.078f, 1.00f);
+	style->Colors[ImGuiCol_ChildBg] = ImVec4(1.00f, 1.00f, 1.00f, 0.f);
+	style->Colors[ImGuiCol_PopupBg] = ImVec4(0.039f, 0.039f, 0.078f, 1.00f);
+	style->Colors[ImGuiCol_Border] = ImVec4(0.80f, 0.80f, 0.83f, 0.0f);
+	style->Colors[ImGuiCol_BorderShadow] = ImVec4(0.92f, 0.91f, 0.88f, 0.00f);
+	style->Colors[ImGuiCol_FrameBg] = ImVec4(0.07f, 0.07f, 0.15f, 1.00f);
+	style->Colors[ImGuiCol_FrameBgHovered] = ImVec4(0.153f, 0.157f, 0.227f, 1.00f);
+	style->Colors[ImGuiCol_FrameBgActive] = ImVec4(0.176f, 0.176f, 0.247f, 1.00f);
+	style->Colors[ImGuiCol_TitleBg] = ImVec4(0.07f, 0.07f, 0.15f, 1.00f);
+	style->Colors[ImGuiCol_TitleBgCollapsed] = ImVec4(0.07f, 0.07f, 0.15f, 1.00f);
+	style->Colors[ImGuiCol_TitleBgActive] = ImVec4(0.07f, 0.07f, 0.15f, 1.00f);
+	style->Colors[ImGuiCol_MenuBarBg] = ImVec4(0.10f, 0.09f, 0.12f, 1.00f);
+	style->Colors[ImGuiCol_ScrollbarBg] = ImVec4(0.310f, 0.310f, 0.310f, 0.00f);
+	style->Colors[ImGuiCol_ScrollbarGrab] = ImVec4(0.310f, 0.310f, 0.310f, 0.31f);
+	style->Colors[ImGuiCol_ScrollbarGrabHovered] = ImVec4(0.410f, 0.410f, 0.410f, 1.00f);
+	style->Colors[ImGuiCol_ScrollbarGrabActive] = ImVec4(0.510f, 0.510f, 0.510f, 1.00f);
+	style->Colors[ImGuiCol_CheckMark] = ImVec4(0.800f, 0.557f, 0.00f, 1.00f);
+	style->Colors[ImGuiCol_SliderGrab] = ImVec4(0.800f, 0.557f, 0.00f, 1.00f);
+	style->Colors[ImGuiCol_SliderGrabActive] = ImVec4(0.800f, 0.557f, 0.00f, 1.00f);
+	style->Colors[ImGuiCol_Button] = ImVec4(0.070f, 0.070f, 0.130f, 1.00f);
+	style->Colors[ImGuiCol_ButtonHovered] = ImVec4(0.070f, 0.070f, 0.130f, 1.00f);
+	style->Colors[ImGuiCol_ButtonActive] = ImVec4(0.070f, 0.070f, 0.130f, 1.00f);
+	style->Colors[ImGuiCol_Header] = ImVec4(0.039f, 0.039f, 0.078f, 1.00f);
+	style->Colors[ImGuiCol_HeaderHovered] = ImVec4(0.070f, 0.070f, 0.130f, 1.00f);
+	style->Colors[ImGuiCol_HeaderActive] = ImVec4(0.070f, 0.070f, 0.130f, 1.00f);
+	style->Colors[ImGuiCol_Separator] = ImVec4(0.039f, 0.039f, 0.078f, 0.00f);
+	style->Colors[ImGuiCol_SeparatorHovered] = ImVec4(0.039f, 0.039f, 0.078f, 0.00f);
+	style->Colors[ImGuiCol_SeparatorActive] = ImVec4(0.039f, 0.039f, 0.078f, 0.00f);
+	style->Colors[ImGuiCol_ResizeGrip] = ImVec4(0.00f, 0.00f, 0.00f, 0.00f);
+	style->Colors[ImGuiCol_ResizeGripHovered] = ImVec4(0.56f, 0.56f, 0.58f, 0.00f);
+	style->Colors[ImGuiCol_ResizeGripActive] = ImVec4(0.06f, 0.05f, 0.07f, 0.00f);
+	style->Colors[ImGuiCol_Tab] = ImVec4(0.039f, 0.039f, 0.078f, 1.00f);
+	style->Colors[ImGuiCol_TabHovered] = ImVec4(0.054f, 0.054f, 0.104f, 1.00f);
+	style->Colors[ImGuiCol_TabActive] = ImVec4(0.070f, 0.070f, 0.130f, 1.00f);
+	////YouGame END Style
+}
+
+void DrawMenu()
+{
+	ImGuiIO& io = ImGui::GetIO();
+	ImGuiStyle* style = &ImGui::GetStyle();
+
+	////YouGame Start MENU
+	ImGuiWindowFlags flags = ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoScrollbar;
+	ImGui::SetNextWindowSize(ImVec2((io.DisplaySize.x) / 1.7f, (io.DisplaySize.y) / 1.2f));
+	ImGui::Begin("Unicore", NULL, flags);
+	if (ImGui::BeginTabBar("###1", ImGuiTabBarFlags_NoTooltip))
+	{
+		if (ImGui::BeginTabItem(IM_LABEL("	Visuals")))
+		{
+			if (ImGui::BeginTabBar("###2", ImGuiTabBarFlags_NoTooltip))
+			{
+
+				if (ImGui::BeginTabItem(IM_LABEL("					Global")))
+				{
+
+					//make 2 buttons
+					ImGui::Button(IM_LABEL("Chests"), ImVec2(ImGui::GetWindowContentRegionWidth() / 2.f, 28.f));
+					ImGui::SameLine();
+					ImGui::Button(IM_LABEL("Misc"), ImVec2(ImGui::GetWindowContentRegionWidth() / 2.f, 28.f));	
+					
+					ImGui::BeginChild(IM_LABEL("1"), ImVec2(ImGui::GetWindowContentRegionWidth() / 3.f, (ImGui::GetWindowSize().y - (style->FramePadding.y * 6)) * 0.4f));
+						ImGui::Checkbox(IM_LABEL("Chest (Common)")	, &chest_com);
+						ImGui::Checkbox(IM_LABEL("Chest (Exquisite)") , &chest_exq);
+						ImGui::Checkbox(IM_LABEL("Chest (Luxorius)")	, &chest_lux);
+						ImGui::Checkbox(IM_LABEL("Wind Slime")		, &w_slime);
+						ImGui::Checkbox(IM_LABEL("Ice Bulk")			, &ice_bulk);
+						ImGui::Checkbox(IM_LABEL("Search Point")		, &s_point);
+						ImGui::Checkbox(IM_LABEL("Bloatty Floatty")	, &bloat_float);
+					ImGui::EndChild();
+
+					ImGui::SameLine();
+					ImGui::BeginChild(IM_LABEL("1.5"), ImVec2(ImGui::GetWindowContentRegionWidth() / 6.25f, (ImGui::GetWindowSize().y - (style->FramePadding.y * 6)) * 0.4f));
+						ImGui::Checkbox(IM_LABEL("Offscreen##1")		, &offscreen1);
+						ImGui::Checkbox(IM_LABEL("Offscreen##2")		, &offscreen2);
+						ImGui::Checkbox(IM_LABEL("Offscreen##3")		, &offscreen3);
+						ImGui::Checkbox(IM_LABEL("Offscreen##4")		, &offscreen4);
+						ImGui::Checkbox(IM_LABEL("Offscreen##5")		, &offscreen5);
+						ImGui::Checkbox(IM_LABEL("Offscreen##6")		, &offscreen6);
+						ImGui::Checkbox(IM_LABEL("Offscreen##7")		, &offscreen7);
+					ImGui::EndChild();
+					
+					ImGui::SameLine();
+					ImGui::BeginChild(IM_LABEL("2"), ImVec2(ImGui::GetWindowContentRegionWidth() / 3.f, (ImGui::GetWindowSize().y - (style->FramePadding.y * 6)) * 0.4f));
+						ImGui::Checkbox(IM_LABEL("Seelie")			, &seelie);
+						ImGui::Checkbox(IM_LABEL("Challenge")			, &challenge);
+						ImGui::Checkbox(IM_LABEL("Oculus")			, &oculi);
+						ImGui::Checkbox(IM_LABEL("Agate")				, &agate);
+					ImGui::EndChild();
+
+					ImGui::SameLine();
+					ImGui::BeginChild(IM_LABEL("2.5"), ImVec2(ImGui::GetWindowContentRegionWidth() / 6.25f, (ImGui::GetWindowSize().y - (style->FramePadding.y * 6)) * 0.4f));
+						ImGui::Checkbox(IM_LABEL("Offscreen##8")		, &offscreen8);
+						ImGui::Checkbox(IM_LABEL("Offscreen##9")		, &offscreen9);
+						ImGui::Checkbox(IM_LABEL("Offscreen##10")		, &offscreen10);
+						ImGui::Checkbox(IM_LABEL("Offscreen##11")		, &offscreen11);
+					ImGui::EndChild();
+
+					ImGui::Button(IM_LABEL("Ores"), ImVec2(ImGui::GetWindowContentRegionWidth() / 2.f, 28.f));
+					ImGui::SameLine();
+					ImGui::Button(IM_LABEL("Locations"), ImVec2(ImGui::GetWindowContentRegionWidth() / 2.f, 28.f));
+					
+					ImGui::BeginChild(IM_LABEL("3"), ImVec2(ImGui::GetWindowContentRegionWidth() / 3.f, (ImGui::GetWindowSize().y - (style->FramePadding.y * 6)) * 0.32f));
+						ImGui::Checkbox(IM_LABEL("Ore (Metal)")		, &ore_met);
+						ImGui::Checkbox(IM_LABEL("Ore (Crystal)")		, &ore_cryst);
+						ImGui::Checkbox(IM_LABEL("Ore (Stone)")		, &ore_stone);
+						ImGui::Checkbox(IM_LABEL("Ore (Electric)")	, &ore_electr);
+						ImGui::Checkbox(IM_LABEL("Ore (Starsilver)")	, &ore_starsilver);
+					ImGui::EndChild();
+
+					ImGui::SameLine();
+					ImGui::BeginChild(IM_LABEL("3.5"), ImVec2(ImGui::GetWindowContentRegionWidth() / 6.25f, (ImGui::GetWindowSize().y - (style->FramePadding.y * 6)) * 0.32f));
+						ImGui::Checkbox(IM_LABEL("Offscreen##12")		, &offscreen12);
+						ImGui::Checkbox(IM_LABEL("Offscreen##13")		, &offscreen13);
+						ImGui::Checkbox(IM_LABEL("Offscreen##14")		, &offscreen14);
+						ImGui::Checkbox(IM_LABEL("Offscreen##15")		, &offscreen15);
+						ImGui::Checkbox(IM_LABEL("Offscreen##16")		, &offscreen16);
+					ImGui::EndChild();
+
+					ImGui::SameLine();
+					ImGui::BeginChild(IM_LABEL("4"), ImVec2(ImGui::GetWindowContentRegionWidth() / 3.f, (ImGui::GetWindowSize().y - (style->FramePadding.y * 6)) * 0.32f));
+						ImGui::Checkbox(IM_LABEL("Archon Towers")		, &towers);
+						ImGui::Checkbox(IM_LABEL("Teleports")			, &teleport);
+					ImGui::EndChild();
+
+					ImGui::SameLine();
+					ImGui::BeginChild(IM_LABEL("4.5"), ImVec2(ImGui::GetWindowContentRegionWidth() / 6.25f, (ImGui::GetWindowSize().y - (style->FramePadding.y * 6)) * 0.32f));
+						ImGui::Checkbox(IM_LABEL("Offscreen##17")		, &offscreen17);
+						ImGui::Checkbox(IM_LABEL("Offscreen##18")		, &offscreen18);
+					ImGui::EndChild();
+					
+					ImGui::EndTabItem();
+				}
+
+
+
+				
+				if (ImGui::BeginTabItem(IM_LABEL("					 Local")))
+				{
+					ImGui::Button(IM_LABEL("Mondstadt"), ImVec2(ImGui::GetWindowContentRegionWidth() / 2.f, 28.f));
+					ImGui::SameLine();
+					ImGui::Button(IM_LABEL("Liyue"), ImVec2(ImGui::GetWindowContentRegionWidth() / 2.f, 28.f));
+
+					ImGui::BeginChild(IM_LABEL("5"), ImVec2(ImGui::GetWindowContentRegionWidth() / 3.f, (ImGui::GetWindowSize().y - (style->FramePadding.y * 2)) * 0.4f));
+						ImGui::Checkbox(IM_LABEL("Calla Lily")	  , &calla_lily);
+						ImGui::Checkbox(IM_LABEL("Cecilia")         , &cecilia);
+						ImGui::Checkbox(IM_LABEL("Dandelion")       , &dandelion);
+						ImGui::Checkbox(IM_LABEL("Philanemo")       , &philanemo);
+						ImGui::Checkbox(IM_LABEL("Small Lamp Grass"), &lamp_grass);
+						ImGui::Checkbox(IM_LABEL("Valberry")        , &vallberry);
+						ImGui::Checkbox(IM_LABEL("Windwhell Aster") , &wind_aster);
+						ImGui::Checkbox(IM_LABEL("Woolfhook")       , &wolfhook);
+					ImGui::EndChild();
+					
+					ImGui::SameLine();
+					ImGui::BeginChild(IM_LABEL("5.5"), ImVec2(ImGui::GetWindowContentRegionWidth() / 6.25f, (ImGui::GetWindowSize().y - (style->FramePadding.y * 2)) * 0.4f));
+						ImGui::Checkbox(IM_LABEL("Offscreen##19")	  , &offscreen19);
+						ImGui::Checkbox(IM_LABEL("Offscreen##20")   , &offscreen20);
+						ImGui::Checkbox(IM_LABEL("Offscreen##21")   , &offscreen21);
+						ImGui::Checkbox(IM_LABEL("Offscreen##22")   , &offscreen22);
+						ImGui::Checkbox(IM_LABEL("Offscreen##23")   , &offscreen23);
+						ImGui::Checkbox(IM_LABEL("Offscreen##24")   , &offscreen24);
+						ImGui::Checkbox(IM_LABEL("Offscreen##25")   , &offscreen25);
+						ImGui::Checkbox(IM_LABEL("Offscreen##26")	  , &offscreen26);
+					ImGui::EndChild();
+
+					ImGui::SameLine();
+					ImGui::BeginChild(IM_LABEL("6"), ImVec2(ImGui::GetWindowContentRegionWidth() / 3.f, (ImGui::GetWindowSize().y - (style->FramePadding.y * 2)) * 0.4f));
+						ImGui::Checkbox(IM_LABEL("Glaze Lily")	  , &glaze_lily);
+						ImGui::Checkbox(IM_LABEL("Juyeun Chili")	  , &chili);
+						ImGui::Checkbox(IM_LABEL("Qingxin")		  , &qingxin);
+						ImGui::Checkbox(IM_LABEL("Silk flower")	  , &silk_flow);
+						ImGui::Checkbox(IM_LABEL("Violetgrass")	  , &violetgrass);
+						ImGui::Checkbox(IM_LABEL("Ore (Cor Lapis)") , &ore_lapis);
+						ImGui::Checkbox(IM_LABEL("Ore (Noc. Jade)") , &ore_nocjade);
+					ImGui::EndChild();
+
+					ImGui::SameLine();
+					ImGui::BeginChild(IM_LABEL("6.5"), ImVec2(ImGui::GetWindowContentRegionWidth() / 6.25f, (ImGui::GetWindowSize().y - (style->FramePadding.y * 2)) * 0.4f));
+						ImGui::Checkbox(IM_LABEL("Offscreen##27")   , &offscreen27);
+						ImGui::Checkbox(IM_LABEL("Offscreen##28")   , &offscreen28);
+						ImGui::Checkbox(IM_LABEL("Offscreen##29")   , &offscreen29);
+						ImGui::Checkbox(IM_LABEL("Offscreen##30")   , &offscreen30);
+						ImGui::Checkbox(IM_LABEL("Offscreen##31")   , &offscreen31);
+						ImGui::Checkbox(IM_LABEL("Offscreen##32")   , &offscreen32);
+						ImGui::Checkbox(IM_LABEL("Offscreen##33")   , &offscreen33);
+					ImGui::EndChild();
+
+					ImGui::Button(IM_LABEL("Inazuma"), ImVec2(ImGui::GetWindowContentRegionWidth() / 2.f, 28.f));
+					ImGui::BeginChild(IM_LABEL("7"), ImVec2(ImGui::GetWindowContentRegionWidth() / 3.f, (ImGui::GetWindowSize().y - (style->FramePadding.y * 2)) * 0.32f));
+						ImGui::Checkbox(IM_LABEL("Sea Ganodema"), &sea_ganodema);
+						ImGui::Checkbox(IM_LABEL("Naku Weed"), &naku_weed);
+						ImGui::Checkbox(IM_LABEL("Sakura Bloom"), &sakura_bloom);
+						ImGui::Checkbox(IM_LABEL("Onikabuto"), &onikabuto);
+						ImGui::Checkbox(IM_LABEL("Dendrobium"), &dendrobium);
+						ImGui::Checkbox(IM_LABEL("Crystal Marrow"), &crystal_marrow);
+						ImGui::Checkbox(IM_LABEL("Amethyst Lump"), &amethyst_lump);
+					ImGui::EndChild();
+
+					ImGui::SameLine();
+					ImGui::BeginChild(IM_LABEL("7.5"), ImVec2(ImGui::GetWindowContentRegionWidth() / 6.25f, (ImGui::GetWindowSize().y - (style->FramePadding.y * 2)) * 0.32f));
+						ImGui::Checkbox(IM_LABEL("Offscreen##34"), &offscreen34);
+						ImGui::Checkbox(IM_LABEL("Offscreen##35"), &offscreen35);
+						ImGui::Checkbox(IM_LABEL("Offscreen##36"), &offscreen36);
+						ImGui::Checkbox(IM_LABEL("Offscreen##37"), &offscreen37);
+						ImGui::Checkbox(IM_LABEL("Offscreen##38"), &offscreen38);
+						ImGui::Checkbox(IM_LABEL("Offscreen##39"), &offscreen39);
+						ImGui::Checkbox(IM_LABEL("Offscreen##40"), &offscreen40);
+					ImGui::EndChild();
+
+					ImGui::EndTabItem();
+				}
+					
+				
+				ImGui::EndTabBar();
+			}
+			ImGui::EndTabItem();
+		}
+	
+		if (ImGui::BeginTabItem(IM_LABEL("	Player")))
+		{
+			char noclip_b[128];
+			char attack_b[128];
+			
+
+			if (noclip_spd > 5.f)
+				sprintf(noclip_b, "Noclip (Unsafe)");
+			else
+				sprintf(noclip_b, "Noclip (Safe)");
+			ImGui::Button(noclip_b, ImVec2(ImGui::GetWindowContentRegionWidth() / 2.f, 28.f));
+			ImGui::SameLine();
+			if (attack_spd > 5.f)
+				sprintf(attack_b, "Attack (Unsafe)");
+			else
+				sprintf(attack_b, "Attack (Safe)");
+			ImGui::Button(attack_b, ImVec2(ImGui::GetWindowContentRegionWidth() / 2.f, 28.f));
+			
+			ImGui::BeginChild(IM_LABEL("1"), ImVec2(ImGui::GetWindowContentRegionWidth() / 2.f, (ImGui::GetWindowSize().y - (style->FramePadding.y * 2)) / 2.7f));
+				ImGui::Checkbox(IM_LABEL("Enabled##1"), &noclip);
+				ImGui::PushItemWidth(ImGui::GetWindowContentRegionWidth()*0.7f);
+				ImGui::SliderFloat("Speed", &noclip_spd,1.00f ,10.00f, "%.3f");
+				//I have no idea how to make hotkey input so it will be input text.
+				ImGui::InputText("Key##1", hotkey_speed, 128);
+			ImGui::EndChild();
+
+			ImGui::SameLine();
+			ImGui::BeginChild(IM_LABEL("2"), ImVec2(ImGui::GetWindowContentRegionWidth() / 2.f, (ImGui::GetWindowSize().y - (style->FramePadding.y * 2)) / 2.7f));
+				ImGui::Checkbox(IM_LABEL("Enabled##2"), &atkspd);
+				ImGui::PushItemWidth(ImGui::GetWindowContentRegionWidth() * 0.7f);
+				ImGui::SliderFloat("Attack", &attack_spd, 1.00f, 10.00f, "%.3f");
+			ImGui::EndChild();
+
+			ImGui::Button(IM_LABEL("Skills"), ImVec2(ImGui::GetWindowContentRegionWidth() / 2.f, 28.f));
+			ImGui::SameLine();
+			ImGui::Button(IM_LABEL("Rapid Fire"), ImVec2(ImGui::GetWindowContentRegionWidth() / 2.f, 28.f));
+
+			ImGui::BeginChild(IM_LABEL("3"), ImVec2(ImGui::GetWindowContentRegionWidth() / 2.f, (ImGui::GetWindowSize().y - (style->FramePadding.y * 2)) / 2.7f));
+				ImGui::Checkbox(IM_LABEL("Infinite Ultimate"), &infult);
+				ImGui::Checkbox(IM_LABEL("No E/Q Cooldown"), &cdreduce);
+				ImGui::PushItemWidth(ImGui::GetWindowContentRegionWidth() * 0.7f);
+				ImGui::SliderFloat("Power##1", &cdreduse_pwr, 0.00f, 1.00f, "%.3f");
+			ImGui::EndChild();
+
+			ImGui::SameLine();
+			ImGui::BeginChild(IM_LABEL("4"), ImVec2(ImGui::GetWindowContentRegionWidth() / 2.f, (ImGui::GetWindowSize().y - (style->FramePadding.y * 2)) / 2.7f));
+				ImGui::Checkbox(IM_LABEL("Rapid Fire"), &rapfire);
+				ImGui::PushItemWidth(ImGui::GetWindowContentRegionWidth() * 0.7f);
+				ImGui::SliderFloat("Power##2", &rapfire_pwr, 1.00f, 50.00f, "%.3f");
+				//I have no idea how to make hotkey input so it will be input text.
+				ImGui::InputText("Key##2", hotkey_rapfire, 128);
+			ImGui::EndChild();
+
+			ImGui::EndTabItem();
+		}
+
+		if (ImGui::BeginTabItem(IM_LABEL("	Others")))
+		{
+			
+			ImGui::Button(IM_LABEL("Game proccess"), ImVec2(ImGui::GetWindowContentRegionWidth() / 2.f, 28.f));
+			ImGui::SameLine();
+			ImGui::Button(IM_LABEL("Magnetizer"), ImVec2(ImGui::GetWindowContentRegionWidth() / 2.f, 28.f));
+			
+			ImGui::BeginChild(IM_LABEL("8"), ImVec2(ImGui::GetWindowContentRegionWidth() / 2.f, (ImGui::GetWindowSize().y - (style->FramePadding.y * 2)) * 0.4f));
+				ImGui::Checkbox(IM_LABEL("Skip cutscenes"), &skip_cutscenes);
+				ImGui::Checkbox(IM_LABEL("Speedup Dialogs"), &speed_dial);
+				//I have no idea how to make hotkey input so it will be input text.
+				ImGui::InputText("Key##3", hotkey_skip_cutscenes, 128);
+				ImGui::Separator();
+				ImGui::Checkbox(IM_LABEL("Freeze mobs"), &freeze_mobs);
+				//I have no idea how to make hotkey input so it will be input text.
+				ImGui::InputText("Key##4", hotkey_freeze_mobs, 128);
+			ImGui::EndChild();
+
+			ImGui::SameLine();
+			ImGui::BeginChild(IM_LABEL("9"), ImVec2(ImGui::GetWindowContentRegionWidth() / 2.f, (ImGui::GetWindowSize().y - (style->FramePadding.y * 2)) * 0.4f));
+				ImGui::Checkbox(IM_LABEL("Magnetize Oculus"), &mag_oculus);
+				ImGui::Checkbox(IM_LABEL("Magnetize Agate"), &mag_agate);
+				ImGui::Checkbox(IM_LABEL("Magnetize Crystal Ore"), &mag_crystal);
+				ImGui::Checkbox(IM_LABEL("Magnetize Metal Ore"), &mag_metal);
+				ImGui::Separator();
+				ImGui::Checkbox(IM_LABEL("Magnetize Mobs"), &mag_mobs);
+				ImGui::SliderFloat("Radius", &mag_mobs_radius,0.0, 150.f, "%.3f");
+				//I have no idea how to make hotkey input so it will be input text.
+				ImGui::InputText("Key##5", hotkey_mag_mobs, 128);
+			ImGui::EndChild();
+			
+			ImGui::EndTabItem();
+		}
+
+		if (ImGui::BeginTabItem(IM_LABEL("	Settings")))
+		{
+			ImGui::Button(IM_LABEL("Settings"), ImVec2(ImGui::GetWindowContentRegionWidth() / 2.f, 28.f));
+			// 
+			ImGui::PushItemWidth(ImGui::GetWindowContentRegionWidth() / 4.f);
+			ImGui::Combo("Language", &lang, "EN\0RU\0");
+			ImGui::EndTabItem();
+		}
+
+		ImGui::EndTabBar();
+
+	}
+	
+	ImGui::End();
+	////YouGame END MENU
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+// Unicore menu, shared between the DX11 application (Menu.cpp) and the headless benchmark (Benchmark.cpp).
+// Both functions only use the Dear ImGui API: they need a current ImGui context.
+void SetupMenuStyle();
+void DrawMenu();